@@ -0,0 +1,85 @@
+/*
+
+Copyright 2017 Adam Reichold
+
+This file is part of rodbc.
+
+rodbc is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+rodbc is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with rodbc.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#pragma once
+
+#include <boost/noncopyable.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace rodbc
+{
+
+/**
+ * @brief The AsyncPoller class
+ *
+ * Drives asynchronous operations on a background thread by polling them until they complete.
+ * Completion callbacks are invoked on that thread and must not throw.
+ */
+class AsyncPoller : private boost::noncopyable
+{
+public:
+    using Poll = std::function< bool () >; ///< returns true once the operation completed
+
+    explicit AsyncPoller( const std::chrono::microseconds interval = std::chrono::microseconds{ 500 } );
+    ~AsyncPoller(); ///< waits for all posted operations to complete
+
+    void post( Poll poll );
+
+private:
+    const std::chrono::microseconds interval_;
+
+    std::mutex lock_;
+    std::condition_variable condition_;
+    std::vector< Poll > pending_;
+    bool done_;
+
+    std::thread thread_;
+
+    void run();
+};
+
+using ExecCallback = std::function< void ( std::exception_ptr error ) >;
+using FetchCallback = std::function< void ( bool result, std::exception_ptr error ) >;
+
+/**
+ * @brief Executes a statement via its pollExec method without blocking the calling thread
+ */
+template< typename Stmt >
+void execAsync( AsyncPoller& poller, Stmt& stmt, ExecCallback callback );
+template< typename Stmt >
+std::future< void > execAsync( AsyncPoller& poller, Stmt& stmt );
+
+/**
+ * @brief Fetches from a statement via its pollFetch method without blocking the calling thread
+ */
+template< typename Stmt >
+void fetchAsync( AsyncPoller& poller, Stmt& stmt, FetchCallback callback );
+template< typename Stmt >
+std::future< bool > fetchAsync( AsyncPoller& poller, Stmt& stmt );
+
+}
@@ -0,0 +1,122 @@
+/*
+
+Copyright 2017 Adam Reichold
+
+This file is part of rodbc.
+
+rodbc is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+rodbc is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with rodbc.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#pragma once
+
+#include "async_poller.hpp"
+
+#include <memory>
+
+namespace rodbc
+{
+
+template< typename Stmt >
+inline void execAsync( AsyncPoller& poller, Stmt& stmt, ExecCallback callback )
+{
+    poller.post( [ &stmt, callback ]()
+    {
+        try
+        {
+            if ( !stmt.pollExec() )
+            {
+                return false;
+            }
+        }
+        catch ( ... )
+        {
+            callback( std::current_exception() );
+
+            return true;
+        }
+
+        callback( nullptr );
+
+        return true;
+    } );
+}
+
+template< typename Stmt >
+inline std::future< void > execAsync( AsyncPoller& poller, Stmt& stmt )
+{
+    const auto promise = std::make_shared< std::promise< void > >();
+
+    execAsync( poller, stmt, [ promise ]( std::exception_ptr error )
+    {
+        if ( error )
+        {
+            promise->set_exception( error );
+        }
+        else
+        {
+            promise->set_value();
+        }
+    } );
+
+    return promise->get_future();
+}
+
+template< typename Stmt >
+inline void fetchAsync( AsyncPoller& poller, Stmt& stmt, FetchCallback callback )
+{
+    poller.post( [ &stmt, callback ]()
+    {
+        bool result;
+
+        try
+        {
+            if ( !stmt.pollFetch( result ) )
+            {
+                return false;
+            }
+        }
+        catch ( ... )
+        {
+            callback( false, std::current_exception() );
+
+            return true;
+        }
+
+        callback( result, nullptr );
+
+        return true;
+    } );
+}
+
+template< typename Stmt >
+inline std::future< bool > fetchAsync( AsyncPoller& poller, Stmt& stmt )
+{
+    const auto promise = std::make_shared< std::promise< bool > >();
+
+    fetchAsync( poller, stmt, [ promise ]( const bool result, std::exception_ptr error )
+    {
+        if ( error )
+        {
+            promise->set_exception( error );
+        }
+        else
+        {
+            promise->set_value( result );
+        }
+    } );
+
+    return promise->get_future();
+}
+
+}
@@ -0,0 +1,111 @@
+/*
+
+Copyright 2017 Adam Reichold
+
+This file is part of rodbc.
+
+rodbc is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+rodbc is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with rodbc.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#pragma once
+
+#include "statement.hpp"
+
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace rodbc
+{
+
+class Batch;
+
+namespace detail
+{
+
+class BatchStatementBase : private boost::noncopyable
+{
+public:
+    virtual ~BatchStatementBase();
+
+protected:
+    explicit BatchStatementBase( std::string stmt );
+
+private:
+    std::string stmt_;
+    std::unique_ptr< Statement > ownStmt_;
+
+    virtual void bindParams( Statement& stmt ) = 0;
+    virtual void fetch( Statement& stmt ) = 0;
+
+    void exec( Connection& conn );
+
+    friend class rodbc::Batch;
+};
+
+}
+
+/**
+ * @brief The BatchStatement class template
+ *
+ * A single statement of a batch whose result rows are collected after executing the batch.
+ */
+template< typename Params, typename Cols >
+class BatchStatement : public detail::BatchStatementBase
+{
+public:
+    explicit BatchStatement( std::string stmt );
+
+    Params& params();
+    const std::vector< Cols >& rows() const;
+
+private:
+    Params params_;
+    Cols row_;
+    std::vector< Cols > rows_;
+
+    void bindParams( Statement& stmt ) override;
+    void fetch( Statement& stmt ) override;
+};
+
+/**
+ * @brief The Batch class
+ *
+ * Submits several statements together and walks their results using SQLMoreResults if the driver supports it,
+ * otherwise executes them one after another.
+ */
+class Batch : private boost::noncopyable
+{
+public:
+    explicit Batch( Connection& conn );
+    Batch( Connection& conn, const bool batched ); ///< force sequential execution by passing false
+
+    bool batched() const;
+
+    template< typename Params = std::tuple<>, typename Cols = std::tuple<> >
+    BatchStatement< Params, Cols >& add( std::string stmt ); ///< references stay valid for the lifetime of the batch
+
+public:
+    void exec();
+
+private:
+    Connection& conn_;
+    const bool batched_;
+
+    std::vector< std::unique_ptr< detail::BatchStatementBase > > stmts_;
+    std::unique_ptr< Statement > stmt_;
+};
+
+}
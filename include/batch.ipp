@@ -0,0 +1,85 @@
+/*
+
+Copyright 2017 Adam Reichold
+
+This file is part of rodbc.
+
+rodbc is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+rodbc is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with rodbc.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#pragma once
+
+#include "batch.hpp"
+
+#include "typed_statement.ipp"
+
+namespace rodbc
+{
+
+template< typename Params, typename Cols >
+inline BatchStatement< Params, Cols >::BatchStatement( std::string stmt )
+: detail::BatchStatementBase{ std::move( stmt ) }
+{
+}
+
+template< typename Params, typename Cols >
+inline Params& BatchStatement< Params, Cols >::params()
+{
+    return params_;
+}
+
+template< typename Params, typename Cols >
+inline const std::vector< Cols >& BatchStatement< Params, Cols >::rows() const
+{
+    return rows_;
+}
+
+template< typename Params, typename Cols >
+inline void BatchStatement< Params, Cols >::bindParams( Statement& stmt )
+{
+    detail::bindEachParam( stmt, params_ );
+}
+
+template< typename Params, typename Cols >
+inline void BatchStatement< Params, Cols >::fetch( Statement& stmt )
+{
+    rows_.clear();
+
+    if ( detail::numberOfColumns< Cols >() == 0 )
+    {
+        return;
+    }
+
+    stmt.unbindCols();
+    detail::bindCols( stmt, row_ );
+
+    while ( stmt.fetch() )
+    {
+        rows_.push_back( row_ );
+    }
+}
+
+template< typename Params, typename Cols >
+inline BatchStatement< Params, Cols >& Batch::add( std::string stmt )
+{
+    std::unique_ptr< BatchStatement< Params, Cols > > batchStmt{ new BatchStatement< Params, Cols >{ std::move( stmt ) } };
+    auto& ref = *batchStmt;
+
+    stmts_.push_back( std::move( batchStmt ) );
+    stmt_.reset();
+
+    return ref;
+}
+
+}
@@ -0,0 +1,80 @@
+/*
+
+Copyright 2017 Adam Reichold
+
+This file is part of rodbc.
+
+rodbc is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+rodbc is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with rodbc.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#pragma once
+
+#include "statement.hpp"
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace rodbc
+{
+
+/**
+ * @brief The BulkInserter class template
+ *
+ * Fills one buffer of parameter sets while the other one is executed on a background thread.
+ * Both buffers are bound once and switched using the parameter bind offset.
+ * The connection must not be used otherwise until the inserter is flushed.
+ */
+template< typename Params >
+class BulkInserter : private boost::noncopyable
+{
+public:
+    BulkInserter( Connection& conn, const char* const stmt, const std::size_t batchSize ); ///< throws std::invalid_argument if batchSize is zero
+    ~BulkInserter(); ///< discards parameter sets which were not flushed
+
+    Params& next(); ///< sends the current buffer in the background if it is full
+    void insert( const Params& params );
+
+    void flush(); ///< sends the remaining parameter sets and waits for completion, rethrowing errors
+
+private:
+    Statement stmt_;
+
+    std::vector< Params > params_;
+    const std::size_t batchSize_;
+    std::size_t buffer_{ 0 };
+    std::size_t size_{ 0 };
+
+    std::ptrdiff_t offset_{ 0 };
+    std::size_t boundSize_;
+
+    std::mutex lock_;
+    std::condition_variable condition_;
+    bool pending_{ false };
+    std::size_t pendingBuffer_{ 0 };
+    std::size_t pendingSize_{ 0 };
+    std::exception_ptr error_;
+    bool done_{ false };
+
+    std::thread thread_;
+
+    void submit();
+    void wait();
+
+    void run();
+};
+
+}
@@ -0,0 +1,177 @@
+/*
+
+Copyright 2017 Adam Reichold
+
+This file is part of rodbc.
+
+rodbc is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+rodbc is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with rodbc.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#pragma once
+
+#include "bulk_inserter.hpp"
+
+#include "typed_statement.ipp"
+
+#include <stdexcept>
+
+namespace rodbc
+{
+
+template< typename Params >
+inline BulkInserter< Params >::BulkInserter( Connection& conn, const char* const stmt, const std::size_t batchSize )
+: stmt_{ conn, stmt }
+, params_( 2 * batchSize )
+, batchSize_{ batchSize }
+, boundSize_{ batchSize }
+{
+    if ( batchSize == 0 )
+    {
+        throw std::invalid_argument{ "Batch size must not be zero." };
+    }
+
+    detail::bindParams( stmt_, params_.front() );
+
+    stmt_.bindParamOffset( offset_ );
+    stmt_.bindParamArray< Params >( batchSize );
+
+    thread_ = std::thread{ &BulkInserter::run, this };
+}
+
+template< typename Params >
+inline BulkInserter< Params >::~BulkInserter()
+{
+    {
+        std::unique_lock< std::mutex > lock{ lock_ };
+
+        done_ = true;
+    }
+
+    condition_.notify_all();
+
+    thread_.join();
+}
+
+template< typename Params >
+inline Params& BulkInserter< Params >::next()
+{
+    if ( size_ == batchSize_ )
+    {
+        submit();
+    }
+
+    return params_[ buffer_ * batchSize_ + size_++ ];
+}
+
+template< typename Params >
+inline void BulkInserter< Params >::insert( const Params& params )
+{
+    next() = params;
+}
+
+template< typename Params >
+inline void BulkInserter< Params >::flush()
+{
+    if ( size_ != 0 )
+    {
+        submit();
+    }
+
+    wait();
+}
+
+template< typename Params >
+inline void BulkInserter< Params >::submit()
+{
+    wait();
+
+    {
+        std::unique_lock< std::mutex > lock{ lock_ };
+
+        pending_ = true;
+        pendingBuffer_ = buffer_;
+        pendingSize_ = size_;
+    }
+
+    condition_.notify_all();
+
+    buffer_ ^= 1;
+    size_ = 0;
+}
+
+template< typename Params >
+inline void BulkInserter< Params >::wait()
+{
+    std::unique_lock< std::mutex > lock{ lock_ };
+
+    condition_.wait( lock, [ this ]() { return !pending_; } );
+
+    if ( error_ )
+    {
+        std::exception_ptr error;
+        std::swap( error, error_ );
+
+        std::rethrow_exception( error );
+    }
+}
+
+template< typename Params >
+inline void BulkInserter< Params >::run()
+{
+    std::unique_lock< std::mutex > lock{ lock_ };
+
+    for ( ;; )
+    {
+        condition_.wait( lock, [ this ]() { return pending_ || done_; } );
+
+        if ( !pending_ )
+        {
+            return;
+        }
+
+        const auto buffer = pendingBuffer_;
+        const auto size = pendingSize_;
+
+        lock.unlock();
+
+        std::exception_ptr error;
+
+        try
+        {
+            offset_ = buffer * batchSize_ * sizeof ( Params );
+
+            if ( boundSize_ != size )
+            {
+                stmt_.bindParamArray< Params >( size );
+
+                boundSize_ = size;
+            }
+
+            stmt_.exec();
+        }
+        catch ( ... )
+        {
+            error = std::current_exception();
+        }
+
+        lock.lock();
+
+        error_ = error;
+        pending_ = false;
+
+        condition_.notify_all();
+    }
+}
+
+}
@@ -0,0 +1,69 @@
+/*
+
+Copyright 2017 Adam Reichold
+
+This file is part of rodbc.
+
+rodbc is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+rodbc is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with rodbc.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#pragma once
+
+#include "typed_statement.hpp"
+
+namespace rodbc
+{
+
+/**
+ * @brief The InOut class template
+ *
+ * Marks a parameter of @p Out whose value is passed to the procedure before it is set by the call.
+ */
+template< typename Type >
+struct InOut
+{
+    Type value;
+};
+
+/**
+ * @brief The CallStatement class template
+ *
+ * Calls a stored procedure, e.g. "{CALL proc(?, ?)}", binding the parameters of @p In to the first markers and those of @p Out to the remaining ones.
+ * Output parameters are only available after all results of the call were processed.
+ */
+template< typename In, typename Out, typename Cols = std::tuple<> >
+class CallStatement : private boost::noncopyable
+{
+public:
+    CallStatement( Connection& conn, const char* const stmt );
+
+    In& params();
+    Out& outParams();
+    const Cols& cols() const;
+
+public:
+    void exec(); ///< processes all results if there are no result columns
+    bool fetch(); ///< processes all remaining results after the last row
+
+private:
+    Statement stmt_;
+    In params_;
+    Out outParams_;
+    Cols cols_;
+    bool done_{ true };
+
+    void processResults();
+};
+
+}
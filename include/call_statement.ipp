@@ -0,0 +1,121 @@
+/*
+
+Copyright 2017 Adam Reichold
+
+This file is part of rodbc.
+
+rodbc is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+rodbc is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with rodbc.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#pragma once
+
+#include "call_statement.hpp"
+
+#include "typed_statement.ipp"
+
+namespace rodbc
+{
+namespace detail
+{
+
+struct OutParamBinder
+{
+    Statement* const stmt;
+
+    template< typename Param >
+    void operator() ( Param& param ) const
+    {
+        stmt->bindOutParam( param );
+    }
+
+    template< typename Param >
+    void operator() ( InOut< Param >& param ) const
+    {
+        stmt->bindOutParam( param.value, ParamDirection::InputOutput );
+    }
+};
+
+}
+
+template< typename In, typename Out, typename Cols >
+inline CallStatement< In, Out, Cols >::CallStatement( Connection& conn, const char* const stmt )
+: stmt_{ conn, stmt }
+{
+    detail::bindParams( stmt_, params_ );
+    boost::fusion::for_each( boost::fusion::flatten( outParams_ ), detail::OutParamBinder{ &stmt_ } );
+
+    detail::bindCols( stmt_, cols_ );
+}
+
+template< typename In, typename Out, typename Cols >
+inline In& CallStatement< In, Out, Cols >::params()
+{
+    return params_;
+}
+
+template< typename In, typename Out, typename Cols >
+inline Out& CallStatement< In, Out, Cols >::outParams()
+{
+    return outParams_;
+}
+
+template< typename In, typename Out, typename Cols >
+inline const Cols& CallStatement< In, Out, Cols >::cols() const
+{
+    return cols_;
+}
+
+template< typename In, typename Out, typename Cols >
+inline void CallStatement< In, Out, Cols >::exec()
+{
+    done_ = false;
+
+    stmt_.exec();
+
+    if ( detail::numberOfColumns< Cols >() == 0 )
+    {
+        processResults();
+    }
+}
+
+template< typename In, typename Out, typename Cols >
+inline bool CallStatement< In, Out, Cols >::fetch()
+{
+    if ( done_ )
+    {
+        return false;
+    }
+
+    if ( stmt_.fetch() )
+    {
+        return true;
+    }
+
+    processResults();
+
+    return false;
+}
+
+template< typename In, typename Out, typename Cols >
+inline void CallStatement< In, Out, Cols >::processResults()
+{
+    // Drivers are only required to set output parameters once SQLMoreResults reports that there are no further results.
+    while ( stmt_.moreResults() )
+    {
+    }
+
+    done_ = true;
+}
+
+}
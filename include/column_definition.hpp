@@ -20,6 +20,7 @@ along with rodbc.  If not, see <http://www.gnu.org/licenses/>.
 */
 #pragma once
 
+#include "connection.hpp"
 #include "types.hpp"
 
 namespace rodbc
@@ -27,8 +28,10 @@ namespace rodbc
 namespace detail
 {
 
-template< typename Type >
-struct ColumnDefinition;
+template< typename Type, DBMS Dbms = DBMS::Other >
+struct ColumnDefinition : ColumnDefinition< Type, DBMS::Other > ///< DBMS without a specific definition use the generic one
+{
+};
 
 template<>
 struct ColumnDefinition< std::int8_t >
@@ -126,6 +129,30 @@ struct ColumnDefinition< Number< Size > >
     static constexpr const char* constraint = "NOT NULL";
 };
 
+template< std::size_t Size >
+struct ColumnDefinition< Blob< Size > >
+{
+    static constexpr const char* type = "VARBINARY";
+    static constexpr std::size_t size = Size;
+    static constexpr const char* constraint = "NOT NULL";
+};
+
+template< std::size_t Size >
+struct ColumnDefinition< Blob< Size >, DBMS::SQLite >
+{
+    static constexpr const char* type = "BLOB";
+    static constexpr std::size_t size = 0;
+    static constexpr const char* constraint = "NOT NULL";
+};
+
+template< std::size_t Size >
+struct ColumnDefinition< Blob< Size >, DBMS::PostgreSQL >
+{
+    static constexpr const char* type = "BYTEA";
+    static constexpr std::size_t size = 0;
+    static constexpr const char* constraint = "NOT NULL";
+};
+
 template<>
 struct ColumnDefinition< Timestamp >
 {
@@ -134,11 +161,11 @@ struct ColumnDefinition< Timestamp >
     static constexpr const char* constraint = "NOT NULL";
 };
 
-template< typename Type >
-struct ColumnDefinition< Nullable< Type > >
+template< typename Type, DBMS Dbms >
+struct ColumnDefinition< Nullable< Type >, Dbms >
 {
-    static constexpr const char* type = ColumnDefinition< Type >::type;
-    static constexpr std::size_t size = ColumnDefinition< Type >::size;
+    static constexpr const char* type = ColumnDefinition< Type, Dbms >::type;
+    static constexpr std::size_t size = ColumnDefinition< Type, Dbms >::size;
     static constexpr const char* constraint = "NULL";
 };
 
@@ -23,6 +23,14 @@ along with rodbc.  If not, see <http://www.gnu.org/licenses/>.
 #include <boost/noncopyable.hpp>
 #include <boost/optional.hpp>
 
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
 namespace rodbc
 {
 
@@ -52,7 +60,8 @@ enum class DBMS
     Other,
     SQLite,
     PostgreSQL,
-    MySQL
+    MySQL,
+    SQLServer
 };
 
 /**
@@ -67,6 +76,89 @@ enum class IsolationLevel
     Serializable
 };
 
+enum class CursorType;
+
+class BindingPlan;
+class SharedDescriptor;
+
+/**
+ * @brief The InsertStrategy enum
+ */
+enum class InsertStrategy
+{
+    ParamArrays, ///< execute an INSERT statement using parameter arrays
+    BulkOperations ///< add the rows via SQLBulkOperations using a scrollable cursor
+};
+
+/**
+ * @brief The PrepareStatistics struct
+ */
+struct PrepareStatistics
+{
+    std::size_t deferred{ 0 }; ///< statements whose preparation was deferred
+    std::size_t prepared{ 0 }; ///< deferred statements which were prepared on first execution
+    std::size_t discarded{ 0 }; ///< deferred statements which were destroyed without ever being executed
+};
+
+/**
+ * @brief The BindValidation enum
+ */
+enum class BindValidation
+{
+    Off,
+    Report, ///< collect mismatches, see Connection::bindMismatches
+    Reject ///< throw an exception when binding
+};
+
+/**
+ * @brief The BindMismatch struct
+ *
+ * A binding whose type differs from the type described by the driver.
+ */
+struct BindMismatch
+{
+    std::string stmt;
+    bool param; ///< whether a parameter or a column was bound
+    unsigned short number;
+    short boundType; ///< the SQL type implied by the binding
+    short describedType; ///< the SQL type described by the driver
+    bool lossy; ///< whether values can lose precision, otherwise the conversion can prevent the use of indexes
+};
+
+/**
+ * @brief The StatementHandles class
+ *
+ * The recycled handles and the state a connection shares with its statements.
+ * Owned by a connection but only weakly referenced by its statements so that they can be used after it was moved and destroyed after it.
+ */
+class StatementHandles : private boost::noncopyable
+{
+public:
+    explicit StatementHandles( void* const dbc );
+    ~StatementHandles();
+
+public:
+    DBMS dbms() const;
+
+    std::chrono::steady_clock::time_point deadline{ std::chrono::steady_clock::time_point::max() };
+    PrepareStatistics prepareStatistics;
+    std::vector< BindMismatch > bindMismatches;
+
+    std::size_t recycled() const;
+    void setMaxRecycled( const std::size_t maxRecycled );
+
+    void* acquire();
+    void recycle( void* const stmt );
+
+private:
+    void* dbc_;
+
+    mutable boost::optional< DBMS > dbms_;
+
+    std::vector< void* > handles_;
+    std::size_t maxRecycled_;
+};
+
 /**
  * @brief The Connection class
  */
@@ -81,6 +173,11 @@ public:
 
 public:
     DBMS dbms() const;
+    bool supportsBatches() const; ///< whether several statements can be executed together yielding separate results
+
+    InsertStrategy insertStrategy() const; ///< bulk operations are preferred only if parameter arrays would be emulated
+    void setInsertStrategy( const InsertStrategy insertStrategy );
+    CursorType bulkOperationsCursor() const; ///< a scrollable cursor type supporting bulk additions, forward-only if there is none
 
     IsolationLevel isolationLevel() const;
     void setIsolationLevel( const IsolationLevel isolationLevel );
@@ -90,13 +187,54 @@ public:
 
     bool isDead() const;
 
+public:
+    using Clock = std::chrono::steady_clock;
+
+    Clock::time_point deadline() const;
+    void setDeadline( const Clock::time_point deadline ); ///< bound the execution of all statements, reset using Clock::time_point::max()
+
+public:
+    bool lazyPrepare() const;
+    void setLazyPrepare( const bool lazyPrepare ); ///< defer the preparation of subsequently created statements until their first execution, unless bind validation is enabled
+
+    const PrepareStatistics& prepareStatistics() const;
+
+public:
+    bool shareDescriptors() const;
+    void setShareDescriptors( const bool shareDescriptors ); ///< let subsequently created statements with identical row types share their application row descriptor
+
+    SharedDescriptor& sharedDescriptor( const std::type_info& type, const BindingPlan& plan ); ///< built from the plan on first use for each type
+
+public:
+    BindValidation bindValidation() const;
+    void setBindValidation( const BindValidation bindValidation ); ///< compare the bindings of subsequently created statements against the types described by the driver, prepares statements when binding even if their preparation was deferred, skips parameters for MySQL and SQLite as their drivers do not describe them
+
+    const std::vector< BindMismatch >& bindMismatches() const; ///< each binding position of a statement text is reported once
+    void clearBindMismatches();
+
+public:
+    std::size_t recycledHandles() const; ///< statement handles which were reset and are kept for reuse
+    void setMaxRecycledHandles( const std::size_t maxRecycledHandles ); ///< zero disables recycling of statement handles
+
 private:
     void* dbc_;
 
-    mutable boost::optional< DBMS > dbms_;
+    mutable boost::optional< bool > batches_;
+    mutable boost::optional< InsertStrategy > insertStrategy_;
+    mutable boost::optional< CursorType > bulkOperationsCursor_;
+
+    bool lazyPrepare_;
+
+    bool shareDescriptors_;
+    std::unordered_map< std::type_index, std::unique_ptr< SharedDescriptor > > descriptors_;
+
+    BindValidation bindValidation_;
+
+    std::shared_ptr< StatementHandles > handles_;
 
     friend class Transaction;
     friend class Statement;
+    friend class SharedDescriptor;
 };
 
 /**
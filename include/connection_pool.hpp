@@ -41,8 +41,12 @@ protected:
 
     Connection makeConnection();
 
+public:
+    void setLazyPrepare( const bool lazyPrepare ); ///< defer preparing the statements of subsequently created connections until their first execution
+
 private:
     const std::string connStr_;
+    bool lazyPrepare_;
 
     boost::mutex env_lock_;
     Environment env_;
@@ -108,6 +112,8 @@ public:
     template< typename... Args >
     explicit ConnectionPool( std::string connStr, Args&&... args );
 
+    using ConnectionPoolBase::setLazyPrepare;
+
     class Lease : private ConnectionPoolImpl::LeaseImpl
     {
     public:
@@ -125,8 +131,11 @@ public:
         template< typename Action >
         typename std::result_of< Action() >::type operator() ( Action action );
 
+        void setDeadline( const Connection::Clock::time_point deadline ); ///< bound the execution of statements by all subsequent actions
+
     private:
         ConnectionPool& pool_;
+        Connection::Clock::time_point deadline_;
     };
 };
 
@@ -41,6 +41,22 @@ struct ConnectionPoolHolder final : ConnectionPoolHolderBase
     Statements stmts;
 };
 
+struct ConnectionDeadline : private boost::noncopyable
+{
+    ConnectionDeadline( Connection& conn, const Connection::Clock::time_point deadline )
+    : conn( conn )
+    {
+        conn.setDeadline( deadline );
+    }
+
+    ~ConnectionDeadline()
+    {
+        conn.setDeadline( Connection::Clock::time_point::max() );
+    }
+
+    Connection& conn;
+};
+
 template< typename Statements, typename ConnectionPoolImpl >
 template< typename... Args >
 inline ConnectionPool< Statements, ConnectionPoolImpl >::ConnectionPool( std::string connStr, Args&&... args )
@@ -53,6 +69,7 @@ template< typename Statements, typename ConnectionPoolImpl >
 inline ConnectionPool< Statements, ConnectionPoolImpl >::Lease::Lease( ConnectionPool& pool )
 : ConnectionPoolImpl::LeaseImpl{ pool }
 , pool_( pool )
+, deadline_{ Connection::Clock::time_point::max() }
 {
 }
 
@@ -74,6 +91,8 @@ inline typename std::result_of< Action( Connection&, Statements& ) >::type Conne
 
     try
     {
+        const ConnectionDeadline deadline{ data->conn, deadline_ };
+
         return action( data->conn, data->stmts );
     }
     catch ( Exception& )
@@ -117,5 +136,11 @@ inline typename std::result_of< Action() >::type ConnectionPool< Statements, Con
     } );
 }
 
+template< typename Statements, typename ConnectionPoolImpl >
+inline void ConnectionPool< Statements, ConnectionPoolImpl >::Lease::setDeadline( const Connection::Clock::time_point deadline )
+{
+    deadline_ = deadline;
+}
+
 }
 }
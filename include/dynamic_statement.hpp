@@ -0,0 +1,105 @@
+/*
+
+Copyright 2017 Adam Reichold
+
+This file is part of rodbc.
+
+rodbc is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+rodbc is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with rodbc.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#pragma once
+
+#include "statement.hpp"
+
+namespace rodbc
+{
+
+/**
+ * @brief The DynamicStatement class
+ *
+ * Discovers the columns of its result set at runtime and fetches them in bulk into a single buffer.
+ */
+class DynamicStatement : private boost::noncopyable
+{
+public:
+    enum class Layout
+    {
+        RowWise,
+        ColumnWise
+    };
+
+    enum class CellType
+    {
+        Integer, ///< accessed as std::int64_t
+        Real, ///< accessed as double
+        Text, ///< accessed as std::string
+        Binary, ///< accessed as std::string
+        Timestamp ///< accessed as Timestamp
+    };
+
+public:
+    DynamicStatement( Connection& conn, const char* const stmt, const std::size_t fetchSize, const Layout layout = Layout::RowWise, const std::size_t maxLength = 1024 ); ///< maxLength limits the bytes stored per text or binary cell
+
+    Statement& params(); ///< bind parameters directly to the underlying statement
+
+    const std::vector< ColumnDescription >& cols() const;
+    CellType cellType( const std::size_t col ) const;
+
+    std::size_t rows() const; ///< number of rows in the current row set
+
+    bool isNull( const std::size_t row, const std::size_t col ) const;
+    bool isTruncated( const std::size_t row, const std::size_t col ) const; ///< whether a text or binary value was longer than its cell
+    template< typename Type >
+    Type get( const std::size_t row, const std::size_t col ) const; ///< throws std::invalid_argument if the type does not match the cell type, text and binary values might be truncated
+
+public:
+    void exec();
+    bool fetch();
+
+private:
+    Statement stmt_;
+
+    std::vector< ColumnDescription > cols_;
+
+    struct Cell
+    {
+        CellType type;
+        std::size_t length;
+        std::size_t value;
+        std::size_t indicator;
+    };
+
+    std::vector< Cell > cells_;
+    std::size_t stride_; ///< distance between subsequent rows of a column
+
+    std::vector< std::uint64_t > arena_;
+    long rowsFetched_{ 0 };
+
+    const char* value( const std::size_t row, const Cell& cell ) const;
+    long indicator( const std::size_t row, const Cell& cell ) const;
+    std::size_t capacity( const Cell& cell ) const;
+
+    const Cell& cell( const std::size_t col, const CellType type ) const;
+};
+
+template<>
+std::int64_t DynamicStatement::get< std::int64_t >( const std::size_t row, const std::size_t col ) const;
+template<>
+double DynamicStatement::get< double >( const std::size_t row, const std::size_t col ) const;
+template<>
+std::string DynamicStatement::get< std::string >( const std::size_t row, const std::size_t col ) const;
+template<>
+Timestamp DynamicStatement::get< Timestamp >( const std::size_t row, const std::size_t col ) const;
+
+}
@@ -28,6 +28,15 @@ along with rodbc.  If not, see <http://www.gnu.org/licenses/>.
 
 namespace rodbc
 {
+
+enum class RowStatus : unsigned short;
+
+template< typename Columns >
+class ColumnArrays;
+
+template< typename Type >
+class FetchBuffer;
+
 namespace detail
 {
 
@@ -42,6 +51,7 @@ struct StmtIteratorBase : boost::intrusive_ref_counter< StmtIteratorBase< Cols >
 
     virtual bool increment() = 0;
     virtual const Cols& dereference() const = 0;
+    virtual RowStatus status() const = 0;
 };
 
 template< typename Stmt, typename Cols >
@@ -51,22 +61,39 @@ struct StmtIterator : StmtIteratorBase< Cols >
 
     bool increment() override;
     const Cols& dereference() const override;
+    RowStatus status() const override;
 
 private:
     Stmt& stmt_;
 };
 
 template< typename Stmt, typename Cols >
-struct StmtIterator< Stmt, std::vector< Cols > > : StmtIteratorBase< Cols >
+struct StmtIterator< Stmt, FetchBuffer< Cols > > : StmtIteratorBase< Cols >
 {
     StmtIterator( Stmt& stmt );
 
     bool increment() override;
     const Cols& dereference() const override;
+    RowStatus status() const override;
 
 private:
     Stmt& stmt_;
-    typename std::vector< Cols >::const_iterator row_;
+    const Cols* row_;
+};
+
+template< typename Stmt, typename Cols >
+struct StmtIterator< Stmt, ColumnArrays< Cols > > : StmtIteratorBase< Cols >
+{
+    StmtIterator( Stmt& stmt );
+
+    bool increment() override;
+    const Cols& dereference() const override;
+    RowStatus status() const override;
+
+private:
+    Stmt& stmt_;
+    std::size_t row_;
+    Cols cols_;
 };
 
 }
@@ -77,6 +104,9 @@ private:
 template< typename Cols >
 class ResultSetIterator : public boost::iterator_facade< ResultSetIterator< Cols >, const Cols, std::input_iterator_tag >
 {
+public:
+    RowStatus status() const; ///< status of the current row as reported by the driver
+
 private:
     template< typename Cols_ > friend class ResultSet;
 
@@ -84,6 +114,8 @@ private:
 
     template< typename Stmt >
     ResultSetIterator( const detail::StmtTag&, Stmt& stmt );
+    template< typename Stmt >
+    ResultSetIterator( const detail::StmtTag&, Stmt& stmt, const bool fetched );
 
 private:
     friend class boost::iterator_core_access;
@@ -105,6 +137,8 @@ class ResultSet
 public:
     template< typename Stmt >
     ResultSet( Stmt& stmt );
+    template< typename Stmt >
+    ResultSet( Stmt& stmt, const bool fetched ); ///< iterate a statement which was already executed and fetched, e.g. using fetchAsync
 
     const ResultSetIterator< Cols >& begin() const;
     ResultSetIterator< Cols > end() const;
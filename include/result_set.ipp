@@ -46,14 +46,20 @@ inline const Cols& StmtIterator< Stmt, Cols >::dereference() const
 }
 
 template< typename Stmt, typename Cols >
-inline StmtIterator< Stmt, std::vector< Cols > >::StmtIterator( Stmt& stmt )
+inline RowStatus StmtIterator< Stmt, Cols >::status() const
+{
+    return stmt_.rowStatus();
+}
+
+template< typename Stmt, typename Cols >
+inline StmtIterator< Stmt, FetchBuffer< Cols > >::StmtIterator( Stmt& stmt )
 : stmt_( stmt )
 , row_{ stmt_.cols().begin() }
 {
 }
 
 template< typename Stmt, typename Cols >
-inline bool StmtIterator< Stmt, std::vector< Cols > >::increment()
+inline bool StmtIterator< Stmt, FetchBuffer< Cols > >::increment()
 {
     if ( ++row_ != stmt_.cols().end() )
     {
@@ -71,25 +77,80 @@ inline bool StmtIterator< Stmt, std::vector< Cols > >::increment()
 }
 
 template< typename Stmt, typename Cols >
-inline const Cols& StmtIterator< Stmt, std::vector< Cols > >::dereference() const
+inline const Cols& StmtIterator< Stmt, FetchBuffer< Cols > >::dereference() const
 {
     return *row_;
 }
 
+template< typename Stmt, typename Cols >
+inline RowStatus StmtIterator< Stmt, FetchBuffer< Cols > >::status() const
+{
+    return stmt_.rowStatus()[ row_ - stmt_.cols().begin() ];
+}
+
+template< typename Stmt, typename Cols >
+inline StmtIterator< Stmt, ColumnArrays< Cols > >::StmtIterator( Stmt& stmt )
+: stmt_( stmt )
+, row_{ 0 }
+{
+    stmt_.cols().get( row_, cols_ );
+}
+
+template< typename Stmt, typename Cols >
+inline bool StmtIterator< Stmt, ColumnArrays< Cols > >::increment()
+{
+    if ( ++row_ == stmt_.cols().size() )
+    {
+        if ( !stmt_.fetch() )
+        {
+            return false;
+        }
+
+        row_ = 0;
+    }
+
+    stmt_.cols().get( row_, cols_ );
+
+    return true;
+}
+
+template< typename Stmt, typename Cols >
+inline const Cols& StmtIterator< Stmt, ColumnArrays< Cols > >::dereference() const
+{
+    return cols_;
+}
+
+template< typename Stmt, typename Cols >
+inline RowStatus StmtIterator< Stmt, ColumnArrays< Cols > >::status() const
+{
+    return stmt_.rowStatus()[ row_ ];
+}
+
 }
 
 template< typename Cols >
 template< typename Stmt >
-inline ResultSetIterator< Cols >::ResultSetIterator( const detail::StmtTag&, Stmt& stmt )
+inline ResultSetIterator< Cols >::ResultSetIterator( const detail::StmtTag& tag, Stmt& stmt )
+: ResultSetIterator{ tag, stmt, ( stmt.exec(), stmt.fetch() ) }
 {
-    stmt.exec();
+}
 
-    if ( stmt.fetch() )
+template< typename Cols >
+template< typename Stmt >
+inline ResultSetIterator< Cols >::ResultSetIterator( const detail::StmtTag&, Stmt& stmt, const bool fetched )
+{
+    if ( fetched )
     {
         it_.reset( new detail::StmtIterator< Stmt, typename std::decay< decltype( stmt.cols() ) >::type >{ stmt } );
     }
 }
 
+template< typename Cols >
+inline RowStatus ResultSetIterator< Cols >::status() const
+{
+    return it_->status();
+}
+
 template< typename Cols >
 void ResultSetIterator< Cols >::increment()
 {
@@ -118,6 +179,13 @@ inline ResultSet< Cols >::ResultSet( Stmt& stmt )
 {
 }
 
+template< typename Cols >
+template< typename Stmt >
+inline ResultSet< Cols >::ResultSet( Stmt& stmt, const bool fetched )
+: begin_{ detail::StmtTag{}, stmt, fetched }
+{
+}
+
 template< typename Cols >
 inline const ResultSetIterator< Cols >& ResultSet< Cols >::begin() const
 {
@@ -0,0 +1,95 @@
+/*
+
+Copyright 2017 Adam Reichold
+
+This file is part of rodbc.
+
+rodbc is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+rodbc is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with rodbc.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#pragma once
+
+#include "typed_statement.hpp"
+
+#include <boost/range/iterator_range.hpp>
+
+#include <condition_variable>
+#include <mutex>
+
+namespace rodbc
+{
+
+/**
+ * @brief The RowsetRing class template
+ *
+ * Provides a ring of rowset slots which are filled by fetching on one thread and consumed in order on another one.
+ */
+template< typename Cols >
+class RowsetRing : private boost::noncopyable
+{
+public:
+    RowsetRing( const std::size_t slots, const std::size_t fetchSize ); ///< throws std::invalid_argument if either is zero
+
+    std::size_t slots() const;
+    std::size_t fetchSize() const;
+
+public:
+    bool consume( std::size_t& slot ); ///< waits for the next filled slot, returns false after the last one
+    boost::iterator_range< const Cols* > rows( const std::size_t slot ) const;
+    void release( const std::size_t slot ); ///< slots must be released in the order they were consumed, throws std::invalid_argument otherwise
+
+private:
+    std::vector< Cols > rows_;
+    std::vector< std::size_t > sizes_;
+    const std::size_t fetchSize_;
+
+    std::mutex lock_;
+    std::condition_variable condition_;
+    std::size_t head_{ 0 };
+    std::size_t tail_{ 0 };
+    std::size_t available_{ 0 };
+    std::size_t inUse_{ 0 };
+    bool closed_{ false };
+
+    void reset();
+    std::size_t acquire();
+    void publish( const std::size_t size );
+    void close();
+
+    template< typename Params_, typename Cols_ > friend class TypedStatement;
+};
+
+template< typename Params, typename Cols >
+class TypedStatement< Params, RowsetRing< Cols > > : private boost::noncopyable
+{
+public:
+    TypedStatement( Connection& conn, const char* const stmt, RowsetRing< Cols >& ring );
+
+    Params& params();
+    RowsetRing< Cols >& cols();
+
+public:
+    void exec(); ///< discards slots of the previous execution which were not consumed yet and waits until the consumer released the others
+    bool fetch(); ///< fills the next free slot, waiting for it to be released if necessary
+
+private:
+    Statement stmt_;
+    Params params_;
+
+    RowsetRing< Cols >& ring_;
+    std::ptrdiff_t offset_{ 0 };
+    long rowsFetched_;
+};
+
+}
@@ -0,0 +1,219 @@
+/*
+
+Copyright 2017 Adam Reichold
+
+This file is part of rodbc.
+
+rodbc is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+rodbc is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with rodbc.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#pragma once
+
+#include "rowset_ring.hpp"
+
+#include "typed_statement.ipp"
+
+#include <stdexcept>
+
+namespace rodbc
+{
+
+template< typename Cols >
+inline RowsetRing< Cols >::RowsetRing( const std::size_t slots, const std::size_t fetchSize )
+: rows_( slots * fetchSize )
+, sizes_( slots )
+, fetchSize_{ fetchSize }
+{
+    if ( slots == 0 || fetchSize == 0 )
+    {
+        throw std::invalid_argument{ "Number of slots and fetch size must not be zero." };
+    }
+}
+
+template< typename Cols >
+inline std::size_t RowsetRing< Cols >::slots() const
+{
+    return sizes_.size();
+}
+
+template< typename Cols >
+inline std::size_t RowsetRing< Cols >::fetchSize() const
+{
+    return fetchSize_;
+}
+
+template< typename Cols >
+inline bool RowsetRing< Cols >::consume( std::size_t& slot )
+{
+    std::unique_lock< std::mutex > lock{ lock_ };
+
+    condition_.wait( lock, [ this ]() { return available_ != 0 || closed_; } );
+
+    if ( available_ == 0 )
+    {
+        return false;
+    }
+
+    slot = tail_;
+
+    tail_ = ( tail_ + 1 ) % sizes_.size();
+    --available_;
+
+    return true;
+}
+
+template< typename Cols >
+inline boost::iterator_range< const Cols* > RowsetRing< Cols >::rows( const std::size_t slot ) const
+{
+    const auto* const begin = rows_.data() + slot * fetchSize_;
+
+    return { begin, begin + sizes_[ slot ] };
+}
+
+template< typename Cols >
+inline void RowsetRing< Cols >::release( const std::size_t slot )
+{
+    {
+        std::unique_lock< std::mutex > lock{ lock_ };
+
+        // The oldest slot in use which is not available any more is the one consumed first.
+        const auto consumed = inUse_ - available_;
+        const auto oldest = ( head_ + sizes_.size() - inUse_ ) % sizes_.size();
+
+        if ( consumed == 0 || slot != oldest )
+        {
+            throw std::invalid_argument{ "Slot was not consumed or is released out of order." };
+        }
+
+        --inUse_;
+    }
+
+    condition_.notify_all();
+}
+
+template< typename Cols >
+inline void RowsetRing< Cols >::reset()
+{
+    std::unique_lock< std::mutex > lock{ lock_ };
+
+    // Slots which were not consumed yet are discarded instead of waiting for the consumer.
+    inUse_ -= available_;
+    available_ = 0;
+
+    condition_.wait( lock, [ this ]() { return inUse_ == 0; } );
+
+    head_ = tail_ = 0;
+    available_ = 0;
+    closed_ = false;
+}
+
+template< typename Cols >
+inline std::size_t RowsetRing< Cols >::acquire()
+{
+    std::unique_lock< std::mutex > lock{ lock_ };
+
+    condition_.wait( lock, [ this ]() { return inUse_ != sizes_.size(); } );
+
+    return head_;
+}
+
+template< typename Cols >
+inline void RowsetRing< Cols >::publish( const std::size_t size )
+{
+    {
+        std::unique_lock< std::mutex > lock{ lock_ };
+
+        sizes_[ head_ ] = size;
+
+        head_ = ( head_ + 1 ) % sizes_.size();
+        ++available_;
+        ++inUse_;
+    }
+
+    condition_.notify_all();
+}
+
+template< typename Cols >
+inline void RowsetRing< Cols >::close()
+{
+    {
+        std::unique_lock< std::mutex > lock{ lock_ };
+
+        closed_ = true;
+    }
+
+    condition_.notify_all();
+}
+
+template< typename Params, typename Cols >
+inline TypedStatement< Params, RowsetRing< Cols > >::TypedStatement( Connection& conn, const char* const stmt, RowsetRing< Cols >& ring )
+: stmt_{ conn, stmt }
+, ring_( ring )
+{
+    detail::bindParams( stmt_, params_ );
+    detail::bindCols( stmt_, ring_.rows_.front() );
+
+    stmt_.bindColOffset( offset_ );
+    stmt_.bindColArray< Cols >( ring_.fetchSize(), rowsFetched_ );
+}
+
+template< typename Params, typename Cols >
+inline Params& TypedStatement< Params, RowsetRing< Cols > >::params()
+{
+    return params_;
+}
+
+template< typename Params, typename Cols >
+inline RowsetRing< Cols >& TypedStatement< Params, RowsetRing< Cols > >::cols()
+{
+    return ring_;
+}
+
+template< typename Params, typename Cols >
+inline void TypedStatement< Params, RowsetRing< Cols > >::exec()
+{
+    ring_.reset();
+
+    stmt_.exec();
+}
+
+template< typename Params, typename Cols >
+inline bool TypedStatement< Params, RowsetRing< Cols > >::fetch()
+{
+    try
+    {
+        const auto slot = ring_.acquire();
+
+        offset_ = slot * ring_.fetchSize() * sizeof ( Cols );
+
+        if ( !stmt_.fetch() || rowsFetched_ == 0 )
+        {
+            ring_.close();
+
+            return false;
+        }
+
+        ring_.publish( rowsFetched_ );
+
+        return true;
+    }
+    catch ( ... )
+    {
+        ring_.close();
+
+        throw;
+    }
+}
+
+}
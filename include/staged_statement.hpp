@@ -50,6 +50,8 @@ public:
     Params& params();
     const Cols& cols() const;
 
+    RowStatus rowStatus() const;
+
 public:
     void exec();
     bool fetch();
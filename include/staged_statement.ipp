@@ -74,6 +74,12 @@ inline const Cols& StagedStatement< StagedParams, Params, Cols, StagingIndex >::
     return stmt_.cols();
 }
 
+template< typename StagedParams, typename Params, typename Cols, typename StagingIndex >
+inline RowStatus StagedStatement< StagedParams, Params, Cols, StagingIndex >::rowStatus() const
+{
+    return stmt_.rowStatus();
+}
+
 template< typename StagedParams, typename Params, typename Cols, typename StagingIndex >
 inline void StagedStatement< StagedParams, Params, Cols, StagingIndex >::exec()
 {
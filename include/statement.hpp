@@ -24,218 +24,973 @@ along with rodbc.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <boost/noncopyable.hpp>
 
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
 #include <vector>
 
 namespace rodbc
 {
 
 class Connection;
+class StatementHandles;
+class Statement;
+
+enum class BindValidation;
 
 /**
- * @brief The Statement class
+ * @brief The ParamStatus enum
+ */
+enum class ParamStatus : unsigned short
+{
+    Success = 0,
+    SuccessWithInfo = 6,
+    Error = 5,
+    Unused = 7,
+    DiagnosticsUnavailable = 1
+};
+
+/**
+ * @brief The ParamOperation enum
+ */
+enum class ParamOperation : unsigned short
+{
+    Proceed = 0,
+    Ignore = 1
+};
+
+/**
+ * @brief The ParamDirection enum
+ */
+enum class ParamDirection : short
+{
+    Input = 1,
+    InputOutput = 2,
+    Output = 4
+};
+
+/**
+ * @brief The RowStatus enum
+ */
+enum class RowStatus : unsigned short
+{
+    Success = 0,
+    SuccessWithInfo = 6,
+    Error = 5,
+    NoRow = 3,
+    Updated = 2,
+    Deleted = 1,
+    Added = 4
+};
+
+/**
+ * @brief The CursorType enum
  */
-class Statement : private boost::noncopyable
+enum class CursorType
+{
+    ForwardOnly,
+    Static,
+    Keyset,
+    Dynamic
+};
+
+/**
+ * @brief The Concurrency enum
+ */
+enum class Concurrency
+{
+    ReadOnly,
+    Lock,
+    RowVersion,
+    Values
+};
+
+/**
+ * @brief The FetchOrientation enum
+ */
+enum class FetchOrientation : short
+{
+    Next = 1,
+    First = 2,
+    Last = 3,
+    Prior = 4,
+    Absolute = 5, ///< the offset is the one-based number of the first row, negative values count from the end
+    Relative = 6 ///< the offset is relative to the first row of the current row set
+};
+
+/**
+ * @brief The CancelHandle class
+ *
+ * Cancels the execution of a statement from another thread, does nothing once the statement was destroyed and its handle released.
+ */
+class CancelHandle
 {
 public:
-    Statement( Connection& conn, const char* const stmt );
-    ~Statement();
+    void cancel() const;
 
-    Statement( Statement&& ) noexcept;
-    Statement& operator= ( Statement&& ) noexcept;
+private:
+    struct Token;
+
+    explicit CancelHandle( std::shared_ptr< Token > token );
+
+    std::shared_ptr< Token > token_; ///< shared with the statement which invalidates it before its handle is recycled
+
+    friend class Statement;
+};
+
+/**
+ * @brief The ColumnDescription struct
+ */
+struct ColumnDescription
+{
+    std::string name;
+    short type; ///< the SQL data type
+    std::size_t size;
+    short digits;
+    bool nullable;
+};
+
+/**
+ * @brief The BindingPlan class
+ *
+ * Records the bindings of a row type relative to its address, so that they are computed once and can be applied to any buffer.
+ */
+class BindingPlan
+{
+public:
+    bool empty() const;
+    bool hasDeferredCols() const;
+
+private:
+    struct Binding
+    {
+        std::ptrdiff_t data;
+        std::ptrdiff_t indicator; ///< negative if there is no indicator
+        short cType;
+        short sqlType;
+        std::size_t size;
+        std::size_t length;
+        ParamDirection direction;
+    };
+
+    std::vector< Binding > params_;
+    std::vector< Binding > cols_;
+
+    friend class Statement;
+    friend class BindingRecorder;
+    friend class SharedDescriptor;
+};
+
+/**
+ * @brief The DeferredBase class
+ */
+class DeferredBase
+{
+protected:
+    DeferredBase() = default;
+    DeferredBase( const DeferredBase& ); ///< copies are not bound
+    DeferredBase& operator= ( const DeferredBase& ); ///< keeps the binding of the target
+    ~DeferredBase();
+
+    Statement* stmt_{ nullptr }; ///< updated by the statement when it is moved or destroyed
+    unsigned short col_{ 0 };
+    mutable unsigned long fetch_{ 0 }; ///< the fetch for which the value was retrieved
+
+    friend class Statement;
+};
+
+/**
+ * @brief The Deferred class template
+ *
+ * A column which is not bound but retrieved using SQLGetData when it is first accessed for the current row.
+ * Drivers may require deferred columns to follow all bound columns and to be accessed in order, and they are only supported by statements fetching single rows.
+ * Copies retrieve the value of the current row and keep it, i.e. they are not bound and do not follow further fetches.
+ * Assigning to a bound column keeps its binding, so it still yields the value of the current row afterwards.
+ */
+template< typename Type >
+class Deferred : public DeferredBase
+{
+public:
+    Deferred() = default;
+    Deferred( const Deferred& that );
+    Deferred& operator= ( const Deferred& that );
+
+    const Type& get() const; ///< throws if neither bound nor copied from a bound column
+
+    const Type& operator* () const;
+    const Type* operator-> () const;
+
+private:
+    mutable Type val_{};
+    bool materialized_{ false };
+};
+
+/**
+ * @brief The SharedDescriptor class
+ *
+ * An explicitly allocated application row descriptor built from a binding plan which several statements can use at once.
+ * Pointing it to another row updates the records of all statements using it, so it must not be used by statements fetching asynchronously.
+ * Statements attaching to it validate its bindings against their result set like individually bound columns.
+ */
+class SharedDescriptor : private boost::noncopyable
+{
+public:
+    SharedDescriptor( Connection& conn, const BindingPlan& plan );
+    ~SharedDescriptor();
+
+    void point( void* const base ); ///< direct the next fetch of any statement using this descriptor to the row at base
+
+private:
+    void* desc_;
+
+    const BindingPlan& plan_; ///< must outlive the descriptor, e.g. a plan computed once per row type
+    const void* base_; ///< the row the records currently point to
+
+    friend class Statement;
+};
 
+/**
+ * @brief The Binder class template
+ *
+ * Maps the supported parameter and column types onto their ODBC descriptions which @p Derived either applies or records.
+ */
+template< typename Derived >
+class Binder
+{
 public:
-    Statement& bindParam( const std::int8_t& param );
-    Statement& bindParam( const std::int16_t& param );
-    Statement& bindParam( const std::int32_t& param );
-    Statement& bindParam( const std::int64_t& param );
+    Derived& bindParam( const std::int8_t& param );
+    Derived& bindParam( const std::int16_t& param );
+    Derived& bindParam( const std::int32_t& param );
+    Derived& bindParam( const std::int64_t& param );
 
-    Statement& bindParam( const std::uint8_t& param );
-    Statement& bindParam( const std::uint16_t& param );
-    Statement& bindParam( const std::uint32_t& param );
-    Statement& bindParam( const std::uint64_t& param );
+    Derived& bindParam( const std::uint8_t& param );
+    Derived& bindParam( const std::uint16_t& param );
+    Derived& bindParam( const std::uint32_t& param );
+    Derived& bindParam( const std::uint64_t& param );
 
-    Statement& bindParam( const float& param );
-    Statement& bindParam( const double& param );
+    Derived& bindParam( const float& param );
+    Derived& bindParam( const double& param );
 
-    Statement& bindParam( const bool& param );
+    Derived& bindParam( const bool& param );
 
-    Statement& bindParam( const Timestamp& param );
+    Derived& bindParam( const Timestamp& param );
 
-    Statement& bindParam( const Nullable< std::int8_t >& param );
-    Statement& bindParam( const Nullable< std::int16_t >& param );
-    Statement& bindParam( const Nullable< std::int32_t >& param );
-    Statement& bindParam( const Nullable< std::int64_t >& param );
+    Derived& bindParam( const Nullable< std::int8_t >& param );
+    Derived& bindParam( const Nullable< std::int16_t >& param );
+    Derived& bindParam( const Nullable< std::int32_t >& param );
+    Derived& bindParam( const Nullable< std::int64_t >& param );
 
-    Statement& bindParam( const Nullable< std::uint8_t >& param );
-    Statement& bindParam( const Nullable< std::uint16_t >& param );
-    Statement& bindParam( const Nullable< std::uint32_t >& param );
-    Statement& bindParam( const Nullable< std::uint64_t >& param );
+    Derived& bindParam( const Nullable< std::uint8_t >& param );
+    Derived& bindParam( const Nullable< std::uint16_t >& param );
+    Derived& bindParam( const Nullable< std::uint32_t >& param );
+    Derived& bindParam( const Nullable< std::uint64_t >& param );
 
-    Statement& bindParam( const Nullable< float >& param );
-    Statement& bindParam( const Nullable< double >& param );
+    Derived& bindParam( const Nullable< float >& param );
+    Derived& bindParam( const Nullable< double >& param );
 
-    Statement& bindParam( const Nullable< bool >& param );
+    Derived& bindParam( const Nullable< bool >& param );
 
-    Statement& bindParam( const Nullable< Timestamp >& param );
+    Derived& bindParam( const Nullable< Timestamp >& param );
 
     template< std::size_t Size >
-    Statement& bindParam( const String< Size >& param );
+    Derived& bindParam( const String< Size >& param );
 
     template< std::size_t Size >
-    Statement& bindParam( const Number< Size >& param );
+    Derived& bindParam( const Number< Size >& param );
 
-    template< typename Params >
-    void bindParamArray( const std::vector< Params >& params );
+    template< std::size_t Size >
+    Derived& bindParam( const Blob< Size >& param );
+    template< std::size_t Size >
+    Derived& bindParam( const Nullable< Blob< Size > >& param );
 
-    Statement& rebindParams();
+    Derived& bindParam( const LongParam& param ); ///< send the value in chunks during execution, only for single parameter sets
+
+    Derived& bindOutParam( std::int8_t& param, const ParamDirection direction = ParamDirection::Output ); ///< bind a parameter which is set by the statement, e.g. by a procedure call, available after all results were processed
+    Derived& bindOutParam( std::int16_t& param, const ParamDirection direction = ParamDirection::Output );
+    Derived& bindOutParam( std::int32_t& param, const ParamDirection direction = ParamDirection::Output );
+    Derived& bindOutParam( std::int64_t& param, const ParamDirection direction = ParamDirection::Output );
+
+    Derived& bindOutParam( std::uint8_t& param, const ParamDirection direction = ParamDirection::Output );
+    Derived& bindOutParam( std::uint16_t& param, const ParamDirection direction = ParamDirection::Output );
+    Derived& bindOutParam( std::uint32_t& param, const ParamDirection direction = ParamDirection::Output );
+    Derived& bindOutParam( std::uint64_t& param, const ParamDirection direction = ParamDirection::Output );
+
+    Derived& bindOutParam( float& param, const ParamDirection direction = ParamDirection::Output );
+    Derived& bindOutParam( double& param, const ParamDirection direction = ParamDirection::Output );
+
+    Derived& bindOutParam( bool& param, const ParamDirection direction = ParamDirection::Output );
+
+    Derived& bindOutParam( Timestamp& param, const ParamDirection direction = ParamDirection::Output );
+
+    Derived& bindOutParam( Nullable< std::int8_t >& param, const ParamDirection direction = ParamDirection::Output );
+    Derived& bindOutParam( Nullable< std::int16_t >& param, const ParamDirection direction = ParamDirection::Output );
+    Derived& bindOutParam( Nullable< std::int32_t >& param, const ParamDirection direction = ParamDirection::Output );
+    Derived& bindOutParam( Nullable< std::int64_t >& param, const ParamDirection direction = ParamDirection::Output );
+
+    Derived& bindOutParam( Nullable< std::uint8_t >& param, const ParamDirection direction = ParamDirection::Output );
+    Derived& bindOutParam( Nullable< std::uint16_t >& param, const ParamDirection direction = ParamDirection::Output );
+    Derived& bindOutParam( Nullable< std::uint32_t >& param, const ParamDirection direction = ParamDirection::Output );
+    Derived& bindOutParam( Nullable< std::uint64_t >& param, const ParamDirection direction = ParamDirection::Output );
+
+    Derived& bindOutParam( Nullable< float >& param, const ParamDirection direction = ParamDirection::Output );
+    Derived& bindOutParam( Nullable< double >& param, const ParamDirection direction = ParamDirection::Output );
+
+    Derived& bindOutParam( Nullable< bool >& param, const ParamDirection direction = ParamDirection::Output );
+
+    Derived& bindOutParam( Nullable< Timestamp >& param, const ParamDirection direction = ParamDirection::Output );
+
+    template< std::size_t Size >
+    Derived& bindOutParam( String< Size >& param, const ParamDirection direction = ParamDirection::Output );
+
+    template< std::size_t Size >
+    Derived& bindOutParam( Number< Size >& param, const ParamDirection direction = ParamDirection::Output );
+
+    template< std::size_t Size >
+    Derived& bindOutParam( Blob< Size >& param, const ParamDirection direction = ParamDirection::Output );
+    template< std::size_t Size >
+    Derived& bindOutParam( Nullable< Blob< Size > >& param, const ParamDirection direction = ParamDirection::Output );
+
+    Derived& bindParam( const ColumnArray< std::int8_t >& param );
+    Derived& bindParam( const ColumnArray< std::int16_t >& param );
+    Derived& bindParam( const ColumnArray< std::int32_t >& param );
+    Derived& bindParam( const ColumnArray< std::int64_t >& param );
+
+    Derived& bindParam( const ColumnArray< std::uint8_t >& param );
+    Derived& bindParam( const ColumnArray< std::uint16_t >& param );
+    Derived& bindParam( const ColumnArray< std::uint32_t >& param );
+    Derived& bindParam( const ColumnArray< std::uint64_t >& param );
+
+    Derived& bindParam( const ColumnArray< float >& param );
+    Derived& bindParam( const ColumnArray< double >& param );
+
+    Derived& bindParam( const ColumnArray< bool >& param );
+
+    Derived& bindParam( const ColumnArray< Timestamp >& param );
+
+    Derived& bindParam( const ColumnArray< Nullable< std::int8_t > >& param );
+    Derived& bindParam( const ColumnArray< Nullable< std::int16_t > >& param );
+    Derived& bindParam( const ColumnArray< Nullable< std::int32_t > >& param );
+    Derived& bindParam( const ColumnArray< Nullable< std::int64_t > >& param );
+
+    Derived& bindParam( const ColumnArray< Nullable< std::uint8_t > >& param );
+    Derived& bindParam( const ColumnArray< Nullable< std::uint16_t > >& param );
+    Derived& bindParam( const ColumnArray< Nullable< std::uint32_t > >& param );
+    Derived& bindParam( const ColumnArray< Nullable< std::uint64_t > >& param );
+
+    Derived& bindParam( const ColumnArray< Nullable< float > >& param );
+    Derived& bindParam( const ColumnArray< Nullable< double > >& param );
+
+    Derived& bindParam( const ColumnArray< Nullable< bool > >& param );
+
+    Derived& bindParam( const ColumnArray< Nullable< Timestamp > >& param );
+
+    template< std::size_t Size >
+    Derived& bindParam( const ColumnArray< String< Size > >& param );
+
+    template< std::size_t Size >
+    Derived& bindParam( const ColumnArray< Number< Size > >& param );
+
+    template< std::size_t Size >
+    Derived& bindParam( const ColumnArray< Blob< Size > >& param );
 
 public:
-    Statement& bindCol( std::int8_t& col );
-    Statement& bindCol( std::int16_t& col );
-    Statement& bindCol( std::int32_t& col );
-    Statement& bindCol( std::int64_t& col );
+    Derived& bindCol( std::int8_t& col );
+    Derived& bindCol( std::int16_t& col );
+    Derived& bindCol( std::int32_t& col );
+    Derived& bindCol( std::int64_t& col );
 
-    Statement& bindCol( std::uint8_t& col );
-    Statement& bindCol( std::uint16_t& col );
-    Statement& bindCol( std::uint32_t& col );
-    Statement& bindCol( std::uint64_t& col );
+    Derived& bindCol( std::uint8_t& col );
+    Derived& bindCol( std::uint16_t& col );
+    Derived& bindCol( std::uint32_t& col );
+    Derived& bindCol( std::uint64_t& col );
 
-    Statement& bindCol( float& col );
-    Statement& bindCol( double& col );
+    Derived& bindCol( float& col );
+    Derived& bindCol( double& col );
 
-    Statement& bindCol( bool& col );
+    Derived& bindCol( bool& col );
 
-    Statement& bindCol( Timestamp& col );
+    Derived& bindCol( Timestamp& col );
 
-    Statement& bindCol( Nullable< std::int8_t >& col );
-    Statement& bindCol( Nullable< std::int16_t >& col );
-    Statement& bindCol( Nullable< std::int32_t >& col );
-    Statement& bindCol( Nullable< std::int64_t >& col );
+    Derived& bindCol( Nullable< std::int8_t >& col );
+    Derived& bindCol( Nullable< std::int16_t >& col );
+    Derived& bindCol( Nullable< std::int32_t >& col );
+    Derived& bindCol( Nullable< std::int64_t >& col );
 
-    Statement& bindCol( Nullable< std::uint8_t >& col );
-    Statement& bindCol( Nullable< std::uint16_t >& col );
-    Statement& bindCol( Nullable< std::uint32_t >& col );
-    Statement& bindCol( Nullable< std::uint64_t >& col );
+    Derived& bindCol( Nullable< std::uint8_t >& col );
+    Derived& bindCol( Nullable< std::uint16_t >& col );
+    Derived& bindCol( Nullable< std::uint32_t >& col );
+    Derived& bindCol( Nullable< std::uint64_t >& col );
 
-    Statement& bindCol( Nullable< float >& col );
-    Statement& bindCol( Nullable< double >& col );
+    Derived& bindCol( Nullable< float >& col );
+    Derived& bindCol( Nullable< double >& col );
 
-    Statement& bindCol( Nullable< bool >& col );
+    Derived& bindCol( Nullable< bool >& col );
 
-    Statement& bindCol( Nullable< Timestamp >& col );
+    Derived& bindCol( Nullable< Timestamp >& col );
 
     template< std::size_t Size >
-    Statement& bindCol( String< Size >& col );
+    Derived& bindCol( String< Size >& col );
 
     template< std::size_t Size >
-    Statement& bindCol( Number< Size >& col );
+    Derived& bindCol( Number< Size >& col );
 
-    template< typename Cols >
-    void bindColArray( std::vector< Cols >& cols, long& rowsFetched );
+    template< std::size_t Size >
+    Derived& bindCol( Blob< Size >& col );
+    template< std::size_t Size >
+    Derived& bindCol( Nullable< Blob< Size > >& col );
 
-    Statement& rebindCols();
+    Derived& bindCol( ColumnArray< std::int8_t >& col );
+    Derived& bindCol( ColumnArray< std::int16_t >& col );
+    Derived& bindCol( ColumnArray< std::int32_t >& col );
+    Derived& bindCol( ColumnArray< std::int64_t >& col );
+
+    Derived& bindCol( ColumnArray< std::uint8_t >& col );
+    Derived& bindCol( ColumnArray< std::uint16_t >& col );
+    Derived& bindCol( ColumnArray< std::uint32_t >& col );
+    Derived& bindCol( ColumnArray< std::uint64_t >& col );
+
+    Derived& bindCol( ColumnArray< float >& col );
+    Derived& bindCol( ColumnArray< double >& col );
+
+    Derived& bindCol( ColumnArray< bool >& col );
+
+    Derived& bindCol( ColumnArray< Timestamp >& col );
+
+    Derived& bindCol( ColumnArray< Nullable< std::int8_t > >& col );
+    Derived& bindCol( ColumnArray< Nullable< std::int16_t > >& col );
+    Derived& bindCol( ColumnArray< Nullable< std::int32_t > >& col );
+    Derived& bindCol( ColumnArray< Nullable< std::int64_t > >& col );
+
+    Derived& bindCol( ColumnArray< Nullable< std::uint8_t > >& col );
+    Derived& bindCol( ColumnArray< Nullable< std::uint16_t > >& col );
+    Derived& bindCol( ColumnArray< Nullable< std::uint32_t > >& col );
+    Derived& bindCol( ColumnArray< Nullable< std::uint64_t > >& col );
+
+    Derived& bindCol( ColumnArray< Nullable< float > >& col );
+    Derived& bindCol( ColumnArray< Nullable< double > >& col );
+
+    Derived& bindCol( ColumnArray< Nullable< bool > >& col );
+
+    Derived& bindCol( ColumnArray< Nullable< Timestamp > >& col );
+
+    template< typename Type >
+    Derived& bindCol( Deferred< Type >& col ); ///< skip the column which is retrieved on demand
+
+    template< std::size_t Size >
+    Derived& bindCol( ColumnArray< String< Size > >& col );
+
+    template< std::size_t Size >
+    Derived& bindCol( ColumnArray< Number< Size > >& col );
+
+    template< std::size_t Size >
+    Derived& bindCol( ColumnArray< Blob< Size > >& col );
+
+    Derived& bindCol( void* const data, const short cType, const std::size_t size, long* const indicator ); ///< bind a buffer of size bytes holding values of the given ODBC C type, e.g. for columns described at runtime
 
 public:
-    Statement& bindParam( std::int8_t&& ) = delete;
-    Statement& bindParam( std::int16_t&& ) = delete;
-    Statement& bindParam( std::int32_t&& ) = delete;
-    Statement& bindParam( std::int64_t&& ) = delete;
+    Derived& bindParam( std::int8_t&& ) = delete;
+    Derived& bindParam( std::int16_t&& ) = delete;
+    Derived& bindParam( std::int32_t&& ) = delete;
+    Derived& bindParam( std::int64_t&& ) = delete;
 
-    Statement& bindParam( std::uint8_t&& ) = delete;
-    Statement& bindParam( std::uint16_t&& ) = delete;
-    Statement& bindParam( std::uint32_t&& ) = delete;
-    Statement& bindParam( std::uint64_t&& ) = delete;
+    Derived& bindParam( std::uint8_t&& ) = delete;
+    Derived& bindParam( std::uint16_t&& ) = delete;
+    Derived& bindParam( std::uint32_t&& ) = delete;
+    Derived& bindParam( std::uint64_t&& ) = delete;
 
-    Statement& bindParam( float&& ) = delete;
-    Statement& bindParam( double&& ) = delete;
+    Derived& bindParam( float&& ) = delete;
+    Derived& bindParam( double&& ) = delete;
 
-    Statement& bindParam( bool&& ) = delete;
+    Derived& bindParam( bool&& ) = delete;
 
-    Statement& bindParam( Timestamp&& ) = delete;
+    Derived& bindParam( Timestamp&& ) = delete;
 
-    Statement& bindParam( Nullable< std::int16_t >&& ) = delete;
-    Statement& bindParam( Nullable< std::int32_t >&& ) = delete;
-    Statement& bindParam( Nullable< std::int64_t >&& ) = delete;
+    Derived& bindParam( Nullable< std::int16_t >&& ) = delete;
+    Derived& bindParam( Nullable< std::int32_t >&& ) = delete;
+    Derived& bindParam( Nullable< std::int64_t >&& ) = delete;
 
-    Statement& bindParam( Nullable< std::uint16_t >&& ) = delete;
-    Statement& bindParam( Nullable< std::uint32_t >&& ) = delete;
-    Statement& bindParam( Nullable< std::uint64_t >&& ) = delete;
+    Derived& bindParam( Nullable< std::uint16_t >&& ) = delete;
+    Derived& bindParam( Nullable< std::uint32_t >&& ) = delete;
+    Derived& bindParam( Nullable< std::uint64_t >&& ) = delete;
 
-    Statement& bindParam( Nullable< float >&& ) = delete;
-    Statement& bindParam( Nullable< double >&& ) = delete;
+    Derived& bindParam( Nullable< float >&& ) = delete;
+    Derived& bindParam( Nullable< double >&& ) = delete;
 
-    Statement& bindParam( Nullable< bool >&& ) = delete;
+    Derived& bindParam( Nullable< bool >&& ) = delete;
 
-    Statement& bindParam( Nullable< Timestamp >&& ) = delete;
+    Derived& bindParam( Nullable< Timestamp >&& ) = delete;
 
     template< std::size_t Size >
-    Statement& bindParam( String< Size >&& ) = delete;
+    Derived& bindParam( String< Size >&& ) = delete;
+
+    template< std::size_t Size >
+    Derived& bindParam( Blob< Size >&& ) = delete;
+    template< std::size_t Size >
+    Derived& bindParam( Nullable< Blob< Size > >&& ) = delete;
+
+    Derived& bindParam( LongParam&& ) = delete;
+
+    template< typename Type >
+    Derived& bindParam( ColumnArray< Type >&& ) = delete;
+
+protected:
+    ParamDirection direction_{ ParamDirection::Input }; ///< the direction of the parameter currently being bound
+
+private:
+    Derived& derived();
+
+    Derived& doBindStringParam( const char* const data, const std::size_t length, const long* const indicator );
+    Derived& doBindStringCol( char* const data, const std::size_t length, long* const indicator );
+
+    Derived& doBindNumberParam( const char* const data, const std::size_t length, const long* const indicator );
+    Derived& doBindNumberCol( char* const data, const std::size_t length, long* const indicator );
+
+    Derived& doBindBinaryParam( const char* const data, const std::size_t length, const long* const indicator );
+    Derived& doBindBinaryCol( char* const data, const std::size_t length, long* const indicator );
+
+    template< typename Param >
+    Derived& doBindParam( const Param* const data, const long* const indicator = nullptr );
+    template< typename Bind >
+    Derived& doBindOutParam( const ParamDirection direction, const Bind& bind );
+    template< typename Col >
+    Derived& doBindCol( Col* const data, long* const indicator = nullptr );
+};
+
+/**
+ * @brief The BindingRecorder class
+ *
+ * Records all bindings of a row relative to its address into a binding plan instead of applying them.
+ */
+class BindingRecorder : public Binder< BindingRecorder >
+{
+public:
+    BindingRecorder( BindingPlan& plan, const void* const base, const std::size_t size ); ///< throws std::invalid_argument when binding values outside of the size bytes at base
+
+private:
+    BindingPlan& plan_;
+    const char* base_;
+    std::size_t size_;
+
+    std::ptrdiff_t offset( const void* const data, const std::size_t size ) const;
+
+    BindingRecorder& doBindDeferredCol( DeferredBase& col );
+
+    BindingRecorder& doBindParam( const void* const data, const short cType, const short sqlType, const std::size_t size, const std::size_t length, const long* const indicator );
+    BindingRecorder& doBindCol( void* const data, const short cType, const std::size_t size, long* const indicator );
+
+    friend class Binder< BindingRecorder >;
+};
+
+/**
+ * @brief The Statement class
+ */
+class Statement : public Binder< Statement >, private boost::noncopyable
+{
+public:
+    Statement( Connection& conn, const char* const stmt, const CursorType cursorType = CursorType::ForwardOnly, const Concurrency concurrency = Concurrency::ReadOnly );
+    ~Statement();
+
+    Statement( Statement&& ) noexcept;
+    Statement& operator= ( Statement&& ) noexcept;
 
+public:
+    template< typename Params >
+    void bindParamArray( const std::vector< Params >& params );
+    template< typename Params >
+    void bindParamArray( const std::size_t count );
     template< typename Params >
     void bindParamArray( std::vector< Params >&& params ) = delete;
 
+    void bindParamOffset( const std::ptrdiff_t& offset ); ///< added to all bound parameter addresses, e.g. to switch between parameter sets of a single buffer without rebinding
+
+    void bindParamArrayByColumn( const std::size_t count ); ///< bind parameter sets using column arrays
+
+    void bindParamStatus( ParamStatus* const status, long& paramsProcessed ); ///< report the outcome of each parameter set
+    void bindParamOperations( const ParamOperation* const operations ); ///< skip parameter sets marked as ignored, unbind using nullptr
+
+    Statement& rebindParams();
+
+    void bindParams( const BindingPlan& plan, const void* const base ); ///< apply the recorded parameter bindings to the row at base
+    void pointParams( const BindingPlan& plan, const void* const base ); ///< re-point parameters bound using the plan to the row at base, without rebinding them
+
+public:
+    template< typename Cols >
+    void bindColArray( std::vector< Cols >& cols, long& rowsFetched );
+    template< typename Cols >
+    void bindColArray( const std::size_t count, long& rowsFetched );
+
+    void bindColOffset( const std::ptrdiff_t& offset ); ///< added to all bound column addresses, e.g. to switch between row sets of a single buffer without rebinding
+
+    void bindColArrayByColumn( const std::size_t count, long& rowsFetched ); ///< bind row sets using column arrays
+    void bindColArrayByRow( const std::size_t rowSize, const std::size_t count, long& rowsFetched ); ///< bind row sets of rows which are rowSize bytes apart, e.g. for rows laid out at runtime
+
+    void bindRowStatus( RowStatus* const status ); ///< report the outcome of each fetched row, unbind using nullptr
+
+    std::vector< ColumnDescription > describeCols(); ///< describe the columns of the result set of the prepared statement
+
+    Statement& rebindCols();
+    Statement& unbindCols(); ///< release all column bindings, e.g. before moving to the next result
+
+    void bindCols( const BindingPlan& plan, void* const base ); ///< apply the recorded column bindings to the row at base
+    void pointCols( const BindingPlan& plan, void* const base ); ///< re-point columns bound using the plan to the row at base, without rebinding them
+    void bindCols( const SharedDescriptor& desc ); ///< use the shared descriptor instead of binding columns individually
+    void resetRowDescriptor(); ///< use the implicitly allocated row descriptor again instead of a shared one
+
+public:
+    void setQueryTimeout( const std::chrono::seconds timeout ); ///< zero disables the timeout
+    void setDeadline( const std::chrono::steady_clock::time_point deadline ); ///< combined with the deadline of the connection, reset using time_point::max()
+
+    CancelHandle cancelHandle() const;
+
 public:
     void exec();
     bool fetch();
+    bool fetchScroll( const FetchOrientation orientation, const long offset = 0 ); ///< position a scrollable cursor
+
+    bool moreResults(); ///< move to the next result of a batch, returns false if there is none
+
+    void bulkAdd(); ///< add the bound row set using the open cursor, requires a scrollable and updatable cursor
+    void closeCursor();
+
+    long rowCount() const; ///< the number of rows affected by the last execution or bulk operation, -1 if unknown
+
+    bool pollExec(); ///< start or continue asynchronous execution, returns false while still executing or sending long parameters
+    bool pollFetch( bool& result ); ///< start or continue an asynchronous fetch, returns false while still executing
+
+    Status tryExec(); ///< report failures of the execution itself instead of throwing
+    Status tryFetch( bool& result ); ///< report failures of the fetch itself instead of throwing
+
+public:
+    using Sink = std::function< void ( const char* const data, const std::size_t size ) >;
+
+    bool getData( const unsigned short col, const Sink& sink, const bool binary = false ); ///< stream an unbound column of the current row in chunks, returns false if it is null
+    bool getData( const unsigned short col, std::ostream& stream, const bool binary = false );
+    bool getData( const unsigned short col, const int fd, const bool binary = false );
 
 private:
     void* stmt_;
     unsigned short param_;
     unsigned short col_;
+    unsigned long fetches_;
     bool pos_;
+    bool async_;
+    bool executing_;
+
+    unsigned long queryTimeout_;
+    unsigned long appliedTimeout_;
+    std::chrono::steady_clock::time_point deadline_;
+
+    std::weak_ptr< StatementHandles > handles_; ///< does not keep the connection's handles alive
+
+    bool prepared_;
+    std::string sql_; ///< the statement text while its preparation is deferred
+
+    bool recyclable_; ///< whether the handle can be reset and reused as no attributes were changed
+
+    BindValidation bindValidation_; ///< taken from the connection when the statement is created
+    std::string text_; ///< the statement text if bindings are validated
+
+    std::vector< DeferredBase* > deferred_; ///< the bound deferred columns which refer back to this statement
+
+    struct PutData;
+    std::unique_ptr< PutData > putData_; ///< where sending data-at-execution parameters resumes while the driver is still executing
+
+    mutable std::shared_ptr< CancelHandle::Token > cancel_; ///< created when the first cancel handle is requested
+
+    void attachDeferred(); ///< point the bound deferred columns to this statement after it was moved
+    void detachDeferred();
+    void releaseDeferred( DeferredBase& col );
+
+    void prepare();
+    short doPrepare();
+    short applyTimeout( bool& expired );
+
+    void setAttr( const int attribute, void* const value );
+
+    void validateParam( const short sqlType, const std::size_t length );
+    void validateCol( const short cType, const std::size_t size );
+    void reportMismatch( const bool param, const unsigned short number, const short boundType, const short describedType, const bool lossy );
+
+    void enableAsync();
+
+    bool doExec( short& rc, bool& expired );
+    bool doFetch( short& rc, const FetchOrientation orientation = FetchOrientation::Next, const long offset = 0 );
+
+    bool doPutData( short& rc );
 
-    Statement& doBindStringParam( const char* const data, const std::size_t length, const long* const indicator );
-    Statement& doBindStringCol( char* const data, const std::size_t length, long* const indicator );
+    Statement& doBindDeferredCol( DeferredBase& col );
 
-    Statement& doBindNumberParam( const char* const data, const std::size_t length, const long* const indicator );
-    Statement& doBindNumberCol( char* const data, const std::size_t length, long* const indicator );
+    template< typename Type >
+    void doGetData( const unsigned short col, Type& value );
+    void doGetData( const unsigned short col, const BindingPlan& plan, void* const base );
+
+    void doPointBindings( const int descriptor, const std::vector< BindingPlan::Binding >& bindings, const char* const base );
 
     void doBindParamArray( const std::size_t size, const std::size_t count );
     void doBindColArray( const std::size_t size, const std::size_t count, long* const rowsFetched );
 
-    template< typename Param >
-    Statement& doBindParam( const Param* const data, const long* const indicator = nullptr );
-    template< typename Col >
-    Statement& doBindCol( Col* const data, long* const indicator = nullptr );
-
     Statement& doBindParam( const void* const data, const short cType, const short sqlType, const std::size_t size, const std::size_t length, const long* const indicator );
     Statement& doBindCol( void* const data, const short cType, const std::size_t size, long* const indicator );
+
+    friend class Binder< Statement >;
+    friend class DeferredBase;
+    friend class SharedDescriptor;
+    template< typename Type > friend class Deferred;
 };
 
+template< typename Derived >
+inline Derived& Binder< Derived >::derived()
+{
+    return static_cast< Derived& >( *this );
+}
+
+template< typename Derived >
 template< std::size_t Size >
-inline Statement& Statement::bindParam( const String< Size >& param )
+inline Derived& Binder< Derived >::bindParam( const String< Size >& param )
 {
     return doBindStringParam( param.val_, Size, &param.ind_ );
 }
 
+template< typename Derived >
 template< std::size_t Size >
-inline Statement& Statement::bindCol( String< Size >& col )
+inline Derived& Binder< Derived >::bindCol( String< Size >& col )
 {
     return doBindStringCol( col.val_, Size, &col.ind_ );
 }
 
+template< typename Derived >
 template< std::size_t Size >
-inline Statement& Statement::bindParam( const Number< Size >& param )
+inline Derived& Binder< Derived >::bindParam( const Number< Size >& param )
 {
     return doBindNumberParam( param.val_.val_, Size, &param.val_.ind_ );
 }
 
+template< typename Derived >
 template< std::size_t Size >
-inline Statement& Statement::bindCol( Number< Size >& col )
+inline Derived& Binder< Derived >::bindCol( Number< Size >& col )
 {
     return doBindNumberCol( col.val_.val_, Size, &col.val_.ind_ );
 }
 
+template< typename Derived >
+template< std::size_t Size >
+inline Derived& Binder< Derived >::bindParam( const Blob< Size >& param )
+{
+    return doBindBinaryParam( param.val_, Size, &param.ind_ );
+}
+
+template< typename Derived >
+template< std::size_t Size >
+inline Derived& Binder< Derived >::bindCol( Blob< Size >& col )
+{
+    return doBindBinaryCol( col.val_, Size, &col.ind_ );
+}
+
+template< typename Derived >
+template< std::size_t Size >
+inline Derived& Binder< Derived >::bindParam( const Nullable< Blob< Size > >& param )
+{
+    return bindParam( param.val_ );
+}
+
+template< typename Derived >
+template< std::size_t Size >
+inline Derived& Binder< Derived >::bindCol( Nullable< Blob< Size > >& col )
+{
+    return bindCol( col.val_ );
+}
+
+template< typename Derived >
+template< std::size_t Size >
+inline Derived& Binder< Derived >::bindOutParam( String< Size >& param, const ParamDirection direction )
+{
+    return doBindOutParam( direction, [ this, &param ]() { doBindStringParam( param.val_, Size, &param.ind_ ); } );
+}
+
+template< typename Derived >
+template< std::size_t Size >
+inline Derived& Binder< Derived >::bindOutParam( Number< Size >& param, const ParamDirection direction )
+{
+    return doBindOutParam( direction, [ this, &param ]() { doBindNumberParam( param.val_.val_, Size, &param.val_.ind_ ); } );
+}
+
+template< typename Derived >
+template< std::size_t Size >
+inline Derived& Binder< Derived >::bindOutParam( Blob< Size >& param, const ParamDirection direction )
+{
+    return doBindOutParam( direction, [ this, &param ]() { doBindBinaryParam( param.val_, Size, &param.ind_ ); } );
+}
+
+template< typename Derived >
+template< std::size_t Size >
+inline Derived& Binder< Derived >::bindOutParam( Nullable< Blob< Size > >& param, const ParamDirection direction )
+{
+    return bindOutParam( param.val_, direction );
+}
+
+template< typename Derived >
+template< std::size_t Size >
+inline Derived& Binder< Derived >::bindParam( const ColumnArray< String< Size > >& param )
+{
+    return doBindStringParam( param.data(), Size, param.indicators() );
+}
+
+template< typename Derived >
+template< std::size_t Size >
+inline Derived& Binder< Derived >::bindParam( const ColumnArray< Number< Size > >& param )
+{
+    return doBindNumberParam( param.data(), Size, param.indicators() );
+}
+
+template< typename Derived >
+template< std::size_t Size >
+inline Derived& Binder< Derived >::bindCol( ColumnArray< String< Size > >& col )
+{
+    return doBindStringCol( col.data(), Size, col.indicators() );
+}
+
+template< typename Derived >
+template< std::size_t Size >
+inline Derived& Binder< Derived >::bindCol( ColumnArray< Number< Size > >& col )
+{
+    return doBindNumberCol( col.data(), Size, col.indicators() );
+}
+
+template< typename Derived >
+template< std::size_t Size >
+inline Derived& Binder< Derived >::bindParam( const ColumnArray< Blob< Size > >& param )
+{
+    return doBindBinaryParam( param.data(), Size, param.indicators() );
+}
+
+template< typename Derived >
+template< std::size_t Size >
+inline Derived& Binder< Derived >::bindCol( ColumnArray< Blob< Size > >& col )
+{
+    return doBindBinaryCol( col.data(), Size, col.indicators() );
+}
+
+template< typename Derived >
+template< typename Type >
+inline Derived& Binder< Derived >::bindCol( Deferred< Type >& col )
+{
+    return derived().doBindDeferredCol( col );
+}
+
+template< typename Type >
+inline void Statement::doGetData( const unsigned short col, Type& value )
+{
+    static const BindingPlan plan = []()
+    {
+        BindingPlan plan;
+        Type value;
+        BindingRecorder{ plan, &value, sizeof ( value ) }.bindCol( value );
+        return plan;
+    }();
+
+    doGetData( col, plan, &value );
+}
+
+template< typename Type >
+inline Deferred< Type >::Deferred( const Deferred& that )
+{
+    *this = that;
+}
+
+template< typename Type >
+inline Deferred< Type >& Deferred< Type >::operator= ( const Deferred& that )
+{
+    if ( this != &that && !stmt_ )
+    {
+        const auto materialized = that.stmt_ || that.materialized_;
+
+        val_ = materialized ? that.get() : Type{};
+        materialized_ = materialized;
+    }
+
+    return *this;
+}
+
+template< typename Type >
+inline const Type& Deferred< Type >::get() const
+{
+    if ( !stmt_ )
+    {
+        if ( !materialized_ )
+        {
+            throw std::invalid_argument{ "Deferred column is not bound." };
+        }
+
+        return val_;
+    }
+
+    if ( fetch_ != stmt_->fetches_ )
+    {
+        stmt_->doGetData( col_, val_ );
+
+        fetch_ = stmt_->fetches_;
+    }
+
+    return val_;
+}
+
+template< typename Type >
+inline const Type& Deferred< Type >::operator* () const
+{
+    return get();
+}
+
+template< typename Type >
+inline const Type* Deferred< Type >::operator-> () const
+{
+    return &get();
+}
+
+template< typename Derived >
+template< typename Bind >
+inline Derived& Binder< Derived >::doBindOutParam( const ParamDirection direction, const Bind& bind )
+{
+    direction_ = direction;
+
+    try
+    {
+        bind();
+    }
+    catch ( ... )
+    {
+        direction_ = ParamDirection::Input;
+
+        throw;
+    }
+
+    direction_ = ParamDirection::Input;
+
+    return derived();
+}
+
 template< typename Params >
 inline void Statement::bindParamArray( const std::vector< Params >& params )
 {
     doBindParamArray( sizeof( Params ), params.size() );
 }
 
+template< typename Params >
+inline void Statement::bindParamArray( const std::size_t count )
+{
+    doBindParamArray( sizeof( Params ), count );
+}
+
 template< typename Cols >
 inline void Statement::bindColArray( std::vector< Cols >& cols , long& rowsFetched )
 {
     doBindColArray( sizeof( Cols ), cols.size(), &rowsFetched );
 }
 
+template< typename Cols >
+inline void Statement::bindColArray( const std::size_t count, long& rowsFetched )
+{
+    doBindColArray( sizeof( Cols ), count, &rowsFetched );
+}
+
 }
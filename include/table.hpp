@@ -20,18 +20,17 @@ along with rodbc.  If not, see <http://www.gnu.org/licenses/>.
 */
 #pragma once
 
+#include "connection.hpp"
 #include "typed_statement.hpp"
 #include "result_set.hpp"
 
 #include <boost/functional/hash.hpp>
 #include <boost/fusion/include/flatten_view.hpp>
-#include <boost/mpl/at.hpp>
 #include <boost/mpl/for_each.hpp>
-#include <boost/mpl/integral_c.hpp>
-#include <boost/mpl/size.hpp>
 #include <boost/optional.hpp>
 
 #include <bitset>
+#include <memory>
 #include <unordered_map>
 
 namespace rodbc
@@ -39,18 +38,6 @@ namespace rodbc
 namespace detail
 {
 
-template< typename Columns, std::size_t Index >
-using ColumnAt = typename boost::mpl::at<
-    boost::fusion::flatten_view< Columns >,
-    boost::mpl::integral_c< std::size_t, Index >
->::type;
-
-template< typename Columns >
-inline constexpr std::size_t numberOfColumns()
-{
-    return boost::mpl::size< boost::fusion::flatten_view< Columns > >::value;
-}
-
 template< typename Columns, typename Action >
 inline void forEachColumn( Action action )
 {
@@ -95,11 +82,46 @@ private:
 
 }
 
+/**
+ * @brief The BulkInsertStatement class template
+ *
+ * Inserts row sets into a table using the strategy reported by Connection::insertStrategy.
+ *
+ * Typed statements execute arbitrary statement text and hence always use parameter arrays.
+ */
+template< typename Columns >
+class BulkInsertStatement : private boost::noncopyable
+{
+public:
+    BulkInsertStatement( Connection& conn, const std::string& tableName, const std::string* const columnNames );
+
+    InsertStrategy strategy() const;
+
+public:
+    void exec( const std::vector< Columns >& rows ); ///< the rows are bound in place instead of being copied
+
+    long rowCount() const; ///< the number of rows inserted by the last execution, -1 if unknown
+
+private:
+    const InsertStrategy strategy_;
+
+    std::unique_ptr< TypedStatement< std::vector< Columns >, std::tuple<> > > insertStmt_;
+
+    std::unique_ptr< Statement > cursorStmt_;
+    const Columns* data_{ nullptr };
+    std::size_t size_{ 0 };
+    long rowsFetched_;
+
+    long rowCount_{ 0 };
+};
+
 constexpr unsigned DROP_TABLE_IF_EXISTS = 1 << 0;
 constexpr unsigned TEMPORARY_TABLE = 1 << 1;
 
 /**
  * @brief The Table class template
+ *
+ * Modifying operations yield the number of affected rows as reported by the driver, -1 if it is unknown.
  */
 template< typename Columns_, std::size_t... PrimaryKey >
 class Table
@@ -129,22 +151,30 @@ public:
     template< std::size_t... Key >
     ResultSet< Columns > selectBy( const ColumnAt< Key >&... key ) const;
 
-    void insert( const Columns& row ); ///< insert all values
+    long insert( const Columns& row ); ///< insert all values
+    long insert( const std::vector< Columns >& rows ); ///< insert all values of all rows using the fastest available strategy
+    template< std::size_t... Value >
+    long insertAt( const Columns& row, const IndexSequence< Value... >& ); ///< insert the given values
+
+    template< std::size_t Key, std::size_t... Value >
+    void insertReturningAt( const std::vector< Columns >& rows, std::vector< ColumnAt< Key > >& keys, const IndexSequence< Value... >& ); ///< insert the given values of all rows, collecting the keys generated by the database aligned with rows, throws if the database does not produce one key per row
+
+    Status tryInsert( const Columns& row ); ///< insert all values, reporting failures instead of throwing
     template< std::size_t... Value >
-    void insertAt( const Columns& row, const IndexSequence< Value... >& ); ///< insert the given values
+    Status tryInsertAt( const Columns& row, const IndexSequence< Value... >& ); ///< insert the given values, reporting failures instead of throwing
 
-    void update( const Columns& row ); ///< update all values based on the primary key
+    long update( const Columns& row ); ///< update all values based on the primary key
     template< std::size_t... Key >
-    void updateBy( const Columns& row, const IndexSequence< Key... >& ); ///< update all values based on the given key
+    long updateBy( const Columns& row, const IndexSequence< Key... >& ); ///< update all values based on the given key
     template< std::size_t... Value >
-    void updateAt( const Columns& row, const IndexSequence< Value... >& ); ///< update the given values based on the pimary key
+    long updateAt( const Columns& row, const IndexSequence< Value... >& ); ///< update the given values based on the pimary key
     template< std::size_t... Value, std::size_t... Key >
-    void updateAtBy( const Columns& row, const IndexSequence< Value... >&, const IndexSequence< Key... >& ); ///< update the given values based on the given key
+    long updateAtBy( const Columns& row, const IndexSequence< Value... >&, const IndexSequence< Key... >& ); ///< update the given values based on the given key
 
-    void delete_( const ColumnAt< PrimaryKey >&... primaryKey );
-    void deleteAll();
+    long delete_( const ColumnAt< PrimaryKey >&... primaryKey );
+    long deleteAll();
     template< std::size_t... Key >
-    void deleteBy( const ColumnAt< Key >&... key );
+    long deleteBy( const ColumnAt< Key >&... key );
 
 protected:
     Connection& conn_;
@@ -154,6 +184,7 @@ protected:
 
 private:
     mutable detail::StatementCache< 2 * numberOfColumns > cache_;
+    std::unique_ptr< BulkInsertStatement< Columns > > bulkInsertStmt_;
 };
 
 /**
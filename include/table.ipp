@@ -72,6 +72,7 @@ inline typename StatementCacheEntry< Params, Cols, Indices... >::Stmt& Statement
     return static_cast< StatementCacheEntry< Params, Cols, Indices... >& >( *entry->second ).stmt;
 }
 
+template< DBMS Dbms >
 struct ColumnTypeInserter
 {
     const char** values;
@@ -79,10 +80,11 @@ struct ColumnTypeInserter
     template< typename Column >
     void operator() ( const Column& )
     {
-        *values++ = ColumnDefinition< Column >::type;
+        *values++ = ColumnDefinition< Column, Dbms >::type;
     }
 };
 
+template< DBMS Dbms >
 struct ColumnSizeInserter
 {
     std::size_t* values;
@@ -90,10 +92,11 @@ struct ColumnSizeInserter
     template< typename Column >
     void operator() ( const Column& )
     {
-        *values++ = ColumnDefinition< Column >::size;
+        *values++ = ColumnDefinition< Column, Dbms >::size;
     }
 };
 
+template< DBMS Dbms >
 struct ColumnConstraintInserter
 {
     const char** values;
@@ -101,10 +104,35 @@ struct ColumnConstraintInserter
     template< typename Column >
     void operator() ( const Column& )
     {
-        *values++ = ColumnDefinition< Column >::constraint;
+        *values++ = ColumnDefinition< Column, Dbms >::constraint;
     }
 };
 
+template< typename Columns, DBMS Dbms >
+inline void defineColumns( const char** const types, std::size_t* const sizes, const char** const constraints )
+{
+    forEachColumn< Columns >( ColumnTypeInserter< Dbms >{ types } );
+    forEachColumn< Columns >( ColumnSizeInserter< Dbms >{ sizes } );
+    forEachColumn< Columns >( ColumnConstraintInserter< Dbms >{ constraints } );
+}
+
+template< typename Columns >
+inline void defineColumns( const DBMS dbms, const char** const types, std::size_t* const sizes, const char** const constraints )
+{
+    switch ( dbms )
+    {
+    case DBMS::SQLite:
+        defineColumns< Columns, DBMS::SQLite >( types, sizes, constraints );
+        break;
+    case DBMS::PostgreSQL:
+        defineColumns< Columns, DBMS::PostgreSQL >( types, sizes, constraints );
+        break;
+    default:
+        defineColumns< Columns, DBMS::Other >( types, sizes, constraints );
+        break;
+    }
+}
+
 void create(
     Connection& conn,
     const std::string& tableName,
@@ -142,6 +170,34 @@ inline std::string insert(
     return insert( tableName, columnNames, { Value... } );
 }
 
+std::string bulkAdd(
+    const std::string& tableName,
+    const std::string* const columnNames, const std::size_t numberOfColumns
+);
+
+std::string insertReturning(
+    const DBMS dbms,
+    const std::string& tableName,
+    const std::string* const columnNames,
+    const std::initializer_list< std::size_t >& value,
+    const std::size_t key,
+    const std::size_t rows
+);
+
+bool returnsKeys( const DBMS dbms ); ///< whether the statement built by insertReturning yields the generated keys
+
+std::int64_t firstInsertId( Connection& conn, const std::size_t rows ); ///< the key generated for the first of the given number of rows inserted last
+
+std::string selectByRowId(
+    const std::string& tableName,
+    const std::string* const columnNames,
+    const std::size_t key
+);
+
+std::size_t insertReturningRows( Connection& conn, const std::size_t numberOfValues ); ///< the number of rows inserted by a single statement whose generated keys stay aligned with the rows
+
+void checkKeys( const std::size_t rows, const std::size_t keys ); ///< throw unless exactly one key was generated per row
+
 std::string update(
     const std::string& tableName,
     const std::string* const columnNames,
@@ -157,6 +213,95 @@ std::string delete_(
 
 }
 
+template< typename Columns >
+inline BulkInsertStatement< Columns >::BulkInsertStatement( Connection& conn, const std::string& tableName, const std::string* const columnNames )
+: strategy_{ conn.insertStrategy() }
+{
+    constexpr auto numberOfColumns = detail::numberOfColumns< Columns >();
+
+    switch ( strategy_ )
+    {
+    case InsertStrategy::ParamArrays:
+        insertStmt_.reset( new TypedStatement< std::vector< Columns >, std::tuple<> >{
+            conn, detail::insert( tableName, columnNames, MakeIndexSequence< numberOfColumns >{} ).c_str()
+        } );
+        break;
+    case InsertStrategy::BulkOperations:
+        cursorStmt_.reset( new Statement{
+            conn, detail::bulkAdd( tableName, columnNames, numberOfColumns ).c_str(),
+            conn.bulkOperationsCursor(), Concurrency::Lock
+        } );
+        break;
+    }
+}
+
+template< typename Columns >
+inline InsertStrategy BulkInsertStatement< Columns >::strategy() const
+{
+    return strategy_;
+}
+
+template< typename Columns >
+inline void BulkInsertStatement< Columns >::exec( const std::vector< Columns >& rows )
+{
+    if ( insertStmt_ )
+    {
+        insertStmt_->exec( rows );
+
+        rowCount_ = insertStmt_->rowCount();
+
+        return;
+    }
+
+    const auto* const data = rows.data();
+    const auto size = rows.size();
+
+    rowCount_ = 0;
+
+    if ( size == 0 )
+    {
+        return;
+    }
+
+    if ( data_ != data )
+    {
+        // Adding rows only reads the bound buffers and the cursor is never fetched from.
+        detail::bindCols( *cursorStmt_, *const_cast< Columns* >( data ) );
+
+        data_ = data;
+    }
+
+    if ( size_ != size )
+    {
+        cursorStmt_->bindColArray< Columns >( size, rowsFetched_ );
+
+        size_ = size;
+    }
+
+    cursorStmt_->exec();
+
+    try
+    {
+        cursorStmt_->bulkAdd();
+
+        rowCount_ = cursorStmt_->rowCount();
+    }
+    catch ( ... )
+    {
+        cursorStmt_->closeCursor();
+
+        throw;
+    }
+
+    cursorStmt_->closeCursor();
+}
+
+template< typename Columns >
+inline long BulkInsertStatement< Columns >::rowCount() const
+{
+    return rowCount_;
+}
+
 template< typename Columns, std::size_t... PrimaryKey >
 template< typename... Values >
 inline Table< Columns, PrimaryKey... >::ColumnNames::ColumnNames( Values&&... values )
@@ -177,13 +322,9 @@ template< typename Columns, std::size_t... PrimaryKey >
 inline void Table< Columns, PrimaryKey... >::create( const unsigned flags )
 {
     const char* columnTypes[ numberOfColumns ];
-    detail::forEachColumn< Columns >( detail::ColumnTypeInserter{ columnTypes } );
-
     std::size_t columnSizes[ numberOfColumns ];
-    detail::forEachColumn< Columns >( detail::ColumnSizeInserter{ columnSizes } );
-
     const char* columnConstraints[ numberOfColumns ];
-    detail::forEachColumn< Columns >( detail::ColumnConstraintInserter{ columnConstraints } );
+    detail::defineColumns< Columns >( conn_.dbms(), columnTypes, columnSizes, columnConstraints );
 
     if ( flags & DROP_TABLE_IF_EXISTS )
     {
@@ -241,74 +382,193 @@ inline ResultSet< Columns > Table< Columns, PrimaryKey... >::selectBy( const Col
 }
 
 template< typename Columns, std::size_t... PrimaryKey >
-inline void Table< Columns, PrimaryKey... >::insert( const Columns& row )
+inline long Table< Columns, PrimaryKey... >::insert( const Columns& row )
 {
-    insertAt( row, MakeIndexSequence< numberOfColumns >{} );
+    return insertAt( row, MakeIndexSequence< numberOfColumns >{} );
 }
 
 template< typename Columns, std::size_t... PrimaryKey >
 template< std::size_t... Value >
-inline void Table< Columns, PrimaryKey... >::insertAt( const Columns& row, const IndexSequence< Value... >& )
+inline long Table< Columns, PrimaryKey... >::insertAt( const Columns& row, const IndexSequence< Value... >& )
 {
     auto& stmt = cache_.template lookUp< detail::StatementCacheEntryType::Insert, Columns, std::tuple<>, Value... >( conn_, [ this ]() { return detail::insert( name_, columnNames_.data(), { Value... } ); } );
 
     stmt.params() = std::forward_as_tuple( std::get< Value >( row )... );
 
     stmt.exec();
+
+    return stmt.rowCount();
+}
+
+template< typename Columns, std::size_t... PrimaryKey >
+inline long Table< Columns, PrimaryKey... >::insert( const std::vector< Columns >& rows )
+{
+    if ( !bulkInsertStmt_ )
+    {
+        bulkInsertStmt_.reset( new BulkInsertStatement< Columns >{ conn_, name_, columnNames_.data() } );
+    }
+
+    bulkInsertStmt_->exec( rows );
+
+    return bulkInsertStmt_->rowCount();
 }
 
 template< typename Columns, std::size_t... PrimaryKey >
-inline void Table< Columns, PrimaryKey... >::update( const Columns& row )
+template< std::size_t Key, std::size_t... Value >
+inline void Table< Columns, PrimaryKey... >::insertReturningAt( const std::vector< Columns >& rows, std::vector< ColumnAt< Key > >& keys, const IndexSequence< Value... >& )
 {
-    updateBy( row, IndexSequence< PrimaryKey... >{} );
+    static_assert( sizeof... ( Value ) != 0, "At least one value must be inserted." );
+
+    const auto dbms = conn_.dbms();
+    const auto chunkSize = detail::insertReturningRows( conn_, sizeof... ( Value ) );
+
+    keys.clear();
+    keys.reserve( rows.size() );
+
+    // The parameters of all rows of a chunk are bound at once, so their storage must not move.
+    std::vector< std::tuple< ColumnAt< Value >... > > params;
+    params.reserve( std::min( chunkSize, rows.size() ) );
+
+    for ( std::size_t begin = 0; begin < rows.size(); begin += chunkSize )
+    {
+        const auto count = std::min( chunkSize, rows.size() - begin );
+
+        params.clear();
+
+        for ( auto row = rows.begin() + begin; row != rows.begin() + begin + count; ++row )
+        {
+            params.emplace_back( std::get< Value >( *row )... );
+        }
+
+        Statement stmt{ conn_, detail::insertReturning( dbms, name_, columnNames_.data(), { Value... }, Key, count ).c_str() };
+
+        for ( const auto& param : params )
+        {
+            detail::bindEachParam( stmt, param );
+        }
+
+        ColumnAt< Key > key;
+
+        if ( detail::returnsKeys( dbms ) )
+        {
+            stmt.bindCol( key );
+        }
+
+        stmt.exec();
+
+        const auto fetched = keys.size();
+
+        if ( detail::returnsKeys( dbms ) )
+        {
+            while ( stmt.fetch() )
+            {
+                keys.push_back( key );
+            }
+        }
+        else if ( dbms == DBMS::SQLite )
+        {
+            // The generated rowids are the keys only if the key column is an alias for the rowid.
+            std::int64_t firstRowId = detail::firstInsertId( conn_, count );
+            std::int64_t lastRowId = firstRowId + static_cast< std::int64_t >( count ) - 1;
+
+            Statement keyStmt{ conn_, detail::selectByRowId( name_, columnNames_.data(), Key ).c_str() };
+            keyStmt.bindParam( firstRowId );
+            keyStmt.bindParam( lastRowId );
+            keyStmt.bindCol( key );
+            keyStmt.exec();
+
+            while ( keyStmt.fetch() )
+            {
+                keys.push_back( key );
+            }
+        }
+        else
+        {
+            const auto first = detail::firstInsertId( conn_, count );
+
+            for ( std::size_t row = 0; row != count; ++row )
+            {
+                keys.push_back( static_cast< ColumnAt< Key > >( first + row ) );
+            }
+        }
+
+        detail::checkKeys( count, keys.size() - fetched );
+    }
+}
+
+template< typename Columns, std::size_t... PrimaryKey >
+inline Status Table< Columns, PrimaryKey... >::tryInsert( const Columns& row )
+{
+    return tryInsertAt( row, MakeIndexSequence< numberOfColumns >{} );
+}
+
+template< typename Columns, std::size_t... PrimaryKey >
+template< std::size_t... Value >
+inline Status Table< Columns, PrimaryKey... >::tryInsertAt( const Columns& row, const IndexSequence< Value... >& )
+{
+    auto& stmt = cache_.template lookUp< detail::StatementCacheEntryType::Insert, Columns, std::tuple<>, Value... >( conn_, [ this ]() { return detail::insert( name_, columnNames_.data(), { Value... } ); } );
+
+    stmt.params() = std::forward_as_tuple( std::get< Value >( row )... );
+
+    return stmt.tryExec();
+}
+
+template< typename Columns, std::size_t... PrimaryKey >
+inline long Table< Columns, PrimaryKey... >::update( const Columns& row )
+{
+    return updateBy( row, IndexSequence< PrimaryKey... >{} );
 }
 
 template< typename Columns, std::size_t... PrimaryKey >
 template< std::size_t... Key >
-inline void Table< Columns, PrimaryKey... >::updateBy( const Columns& row, const IndexSequence< Key... >& key )
+inline long Table< Columns, PrimaryKey... >::updateBy( const Columns& row, const IndexSequence< Key... >& key )
 {
-    updateAtBy( row, MakeIndexSequence< numberOfColumns >{}, key );
+    return updateAtBy( row, MakeIndexSequence< numberOfColumns >{}, key );
 }
 
 template< typename Columns, std::size_t... PrimaryKey >
 template< std::size_t... Value >
-inline void Table< Columns, PrimaryKey... >::updateAt( const Columns& row, const IndexSequence< Value... >& value )
+inline long Table< Columns, PrimaryKey... >::updateAt( const Columns& row, const IndexSequence< Value... >& value )
 {
-    updateAtBy( row, value, IndexSequence< PrimaryKey... >{} );
+    return updateAtBy( row, value, IndexSequence< PrimaryKey... >{} );
 }
 
 template< typename Columns, std::size_t... PrimaryKey >
 template< std::size_t... Value, std::size_t... Key >
-inline void Table< Columns, PrimaryKey... >::updateAtBy( const Columns& row, const IndexSequence< Value... >&, const IndexSequence< Key... >& )
+inline long Table< Columns, PrimaryKey... >::updateAtBy( const Columns& row, const IndexSequence< Value... >&, const IndexSequence< Key... >& )
 {
     auto& stmt = cache_.template lookUp< detail::StatementCacheEntryType::Update, std::tuple< Columns, Columns >, std::tuple<>, Value..., (numberOfColumns + Key)... >( conn_, [ this ]() { return detail::update( name_, columnNames_.data(), { Value... }, { Key... } ); } );
 
     stmt.params() = std::forward_as_tuple( std::get< Value >( row )..., std::get< Key >( row )... );
 
     stmt.exec();
+
+    return stmt.rowCount();
 }
 
 template< typename Columns, std::size_t... PrimaryKey >
-inline void Table< Columns, PrimaryKey... >::delete_( const ColumnAt< PrimaryKey >&... primaryKey )
+inline long Table< Columns, PrimaryKey... >::delete_( const ColumnAt< PrimaryKey >&... primaryKey )
 {
-    deleteBy< PrimaryKey... >( primaryKey... );
+    return deleteBy< PrimaryKey... >( primaryKey... );
 }
 
 template< typename Columns, std::size_t... PrimaryKey >
-inline void Table< Columns, PrimaryKey... >::deleteAll()
+inline long Table< Columns, PrimaryKey... >::deleteAll()
 {
-    deleteBy<>();
+    return deleteBy<>();
 }
 
 template< typename Columns, std::size_t... PrimaryKey >
 template< std::size_t... Key >
-inline void Table< Columns, PrimaryKey... >::deleteBy( const ColumnAt< Key >&... key )
+inline long Table< Columns, PrimaryKey... >::deleteBy( const ColumnAt< Key >&... key )
 {
     auto& stmt = cache_.template lookUp< detail::StatementCacheEntryType::Delete, Columns, std::tuple<>, Key... >( conn_, [ this ]() { return detail::delete_( name_, columnNames_.data(), { Key... } ); } );
 
     stmt.params() = std::forward_as_tuple( key... );
 
     stmt.exec();
+
+    return stmt.rowCount();
 }
 
 template< typename Columns, std::size_t... PrimaryKey >
@@ -20,10 +20,208 @@ along with rodbc.  If not, see <http://www.gnu.org/licenses/>.
 */
 #pragma once
 
+#include "connection.hpp"
 #include "statement.hpp"
 
+#include <boost/fusion/include/advance.hpp>
+#include <boost/fusion/include/begin.hpp>
+#include <boost/fusion/include/flatten_view.hpp>
+#include <boost/fusion/include/std_tuple.hpp>
+#include <boost/fusion/include/value_of.hpp>
+#include <boost/mpl/count_if.hpp>
+#include <boost/mpl/placeholders.hpp>
+#include <boost/mpl/size.hpp>
+
+#include <array>
+#include <chrono>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <typeinfo>
+
 namespace rodbc
 {
+namespace detail
+{
+
+template< typename Columns, std::size_t Index >
+using ColumnAt = typename boost::fusion::result_of::value_of<
+    typename boost::fusion::result_of::advance_c<
+        typename boost::fusion::result_of::begin< boost::fusion::flatten_view< Columns > >::type,
+        Index
+    >::type
+>::type;
+
+template< typename Columns >
+inline constexpr std::size_t numberOfColumns()
+{
+    return boost::mpl::size< boost::fusion::flatten_view< Columns > >::value;
+}
+
+template< typename Type >
+struct IsDeferred : std::false_type {};
+
+template< typename Type >
+struct IsDeferred< Deferred< Type > > : std::true_type {};
+
+template< typename Columns >
+inline constexpr bool hasDeferredColumns()
+{
+    return boost::mpl::count_if< boost::fusion::flatten_view< Columns >, IsDeferred< boost::mpl::_1 > >::value != 0;
+}
+
+class ParamArrayStatus
+{
+public:
+    void bind( Statement& stmt, const std::size_t size );
+    void exec( Statement& stmt );
+    bool pollExec( Statement& stmt );
+    Status tryExec( Statement& stmt );
+
+    const std::vector< ParamStatus >& status() const;
+    std::size_t processed() const;
+
+    bool continueOnError() const;
+    void setContinueOnError( const bool continueOnError );
+
+private:
+    std::vector< ParamStatus > status_;
+    std::vector< ParamStatus > execStatus_;
+    std::vector< ParamOperation > operations_;
+    long processed_{ 0 };
+
+    bool continueOnError_{ false };
+    bool bound_{ false };
+    bool executing_{ false };
+
+    enum class Outcome
+    {
+        Completed,
+        Retry, ///< remaining parameter sets have to be executed again
+        Failed ///< the failure of the execution has to be reported
+    };
+
+    void begin();
+    Outcome complete( const bool failed );
+};
+
+class AdaptiveFetchSize
+{
+public:
+    bool enabled() const;
+    void setMaxRows( const std::size_t maxRows );
+
+    std::size_t fetchSize() const;
+
+    void exec();
+    void fetched( const std::size_t rows, const std::size_t fetchSize, const std::chrono::steady_clock::duration latency );
+
+private:
+    std::size_t maxRows_{ 0 };
+    std::size_t fetchSize_{ 0 };
+
+    double rowsPerExec_{ 0.0 };
+    std::size_t rows_{ 0 };
+    std::size_t executions_{ 0 };
+
+    std::size_t sampledFetchSize_{ 0 };
+    std::size_t samples_{ 0 };
+    double throughput_{ 0.0 }; ///< smoothed over the samples taken at the current fetch size
+    double previousThroughput_{ 0.0 }; ///< at the previous fetch size
+    bool saturated_{ false };
+};
+
+template< typename Columns, typename Indices = MakeIndexSequence< numberOfColumns< Columns >() > >
+struct ColumnArraysOf;
+
+template< typename Columns, std::size_t... Indices >
+struct ColumnArraysOf< Columns, IndexSequence< Indices... > >
+{
+    using type = std::tuple< ColumnArray< ColumnAt< Columns, Indices > >... >;
+};
+
+}
+
+/**
+ * @brief The ColumnArrays class template
+ *
+ * Stores one contiguous array per flattened column of @p Columns for column-wise binding.
+ */
+template< typename Columns >
+class ColumnArrays
+{
+public:
+    static constexpr auto numberOfColumns = detail::numberOfColumns< Columns >();
+
+    template< std::size_t Index >
+    using ColumnArrayAt = ColumnArray< detail::ColumnAt< Columns, Index > >;
+
+    std::size_t size() const;
+    void resize( const std::size_t size );
+
+    void get( const std::size_t index, Columns& row ) const;
+    void set( const std::size_t index, const Columns& row );
+
+    template< std::size_t Index >
+    ColumnArrayAt< Index >& column();
+    template< std::size_t Index >
+    const ColumnArrayAt< Index >& column() const;
+
+private:
+    typename detail::ColumnArraysOf< Columns >::type columns_;
+
+    template< typename Params_, typename Cols_ > friend class TypedStatement;
+};
+
+/**
+ * @brief The FetchBuffer class template
+ *
+ * Fixed storage for the row sets of a bulk fetch, rows are constructed only once they are bound and only the number of valid rows changes afterwards.
+ *
+ * It offers the read-only container interface of std::vector but is not one, callers which kept a reference to the std::vector returned by TypedStatement::cols() need to keep a reference to the buffer instead.
+ */
+template< typename Type >
+class FetchBuffer : private boost::noncopyable
+{
+public:
+    FetchBuffer() = default;
+    ~FetchBuffer();
+
+    using value_type = Type;
+    using size_type = std::size_t;
+    using const_iterator = const Type*;
+    using iterator = const_iterator;
+
+    const Type* data() const;
+
+    const Type* begin() const;
+    const Type* end() const;
+
+    std::size_t size() const; ///< the number of valid rows
+    bool empty() const;
+
+    const Type& operator[] ( const std::size_t index ) const;
+
+    const Type& front() const;
+    const Type& back() const;
+
+private:
+    using Storage = typename std::aligned_storage< sizeof ( Type ), alignof ( Type ) >::type;
+
+    std::unique_ptr< Storage[] > storage_;
+    std::size_t capacity_{ 0 };
+    std::size_t constructed_{ 0 };
+    std::size_t size_{ 0 };
+
+    Type* rows();
+    const Type* rows() const;
+
+    void reserve( const std::size_t capacity ); ///< reallocate only if the storage needs to grow
+    void construct( const std::size_t count ); ///< construct rows up to the given count
+    void destroy();
+
+    template< typename Params_, typename Cols_ > friend class TypedStatement;
+};
 
 /**
  * @brief The TypedStatement class template
@@ -37,14 +235,29 @@ public:
     Params& params();
     const Cols& cols() const;
 
+    RowStatus rowStatus() const;
+
 public:
     void exec();
     bool fetch();
 
+    bool pollExec(); ///< see Statement::pollExec
+    bool pollFetch( bool& result ); ///< see Statement::pollFetch, stops using a shared descriptor
+
+    Status tryExec(); ///< see Statement::tryExec
+    Status tryFetch( bool& result ); ///< see Statement::tryFetch
+
+    long rowCount() const; ///< see Statement::rowCount
+
 private:
     Statement stmt_;
     Params params_;
     Cols cols_;
+    RowStatus rowStatus_{ RowStatus::Success };
+
+    SharedDescriptor* desc_{ nullptr };
+
+    void pointDescriptor();
 };
 
 template< typename Params >
@@ -55,27 +268,80 @@ public:
 
     std::vector< Params >& params();
 
+    const std::vector< ParamStatus >& paramStatus() const;
+    std::size_t paramsProcessed() const;
+
+    bool continueOnError() const;
+    void setContinueOnError( const bool continueOnError ); ///< skip failed parameter sets instead of throwing
+
 public:
-    void exec();
+    void exec(); ///< always uses parameter arrays, see BulkInsertStatement for inserting using Connection::insertStrategy
+    void exec( const std::vector< Params >& params ); ///< bind the given parameter sets in place instead of copying them into params()
+
+    bool pollExec(); ///< see Statement::pollExec
+
+    Status tryExec(); ///< see Statement::tryExec, failures reported per parameter set when continuing on errors are not returned
+
+    long rowCount() const; ///< see Statement::rowCount, usually the total over all parameter sets
 
 private:
     Statement stmt_;
 
     std::vector< Params > params_;
-    Params* data_{ nullptr };
+    const Params* data_{ nullptr };
+    std::size_t size_{ 0 };
+
+    bool bound_{ false }; ///< whether the binding plan was applied, afterwards only its pointers are updated
+
+    detail::ParamArrayStatus status_;
+
+    void bindParams( const std::vector< Params >& params );
+};
+
+template< typename Params >
+class TypedStatement< ColumnArrays< Params >, std::tuple<> > : private boost::noncopyable
+{
+public:
+    TypedStatement( Connection& conn, const char* const stmt );
+
+    ColumnArrays< Params >& params();
+
+    const std::vector< ParamStatus >& paramStatus() const;
+    std::size_t paramsProcessed() const;
+
+    bool continueOnError() const;
+    void setContinueOnError( const bool continueOnError ); ///< skip failed parameter sets instead of throwing
+
+public:
+    void exec();
+
+    bool pollExec(); ///< see Statement::pollExec
+
+    Status tryExec(); ///< see Statement::tryExec, failures reported per parameter set when continuing on errors are not returned
+
+    long rowCount() const; ///< see Statement::rowCount, usually the total over all parameter sets
+
+private:
+    Statement stmt_;
+
+    ColumnArrays< Params > params_;
+    std::array< const void*, ColumnArrays< Params >::numberOfColumns > data_{};
     std::size_t size_{ 0 };
 
+    detail::ParamArrayStatus status_;
+
     void bindParams();
 };
 
 template< typename Params, typename Cols >
-class TypedStatement< Params, std::vector< Cols > > : private boost::noncopyable
+class TypedStatement< Params, ColumnArrays< Cols > > : private boost::noncopyable
 {
 public:
     TypedStatement( Connection& conn, const char* const stmt, const std::size_t fetchSize );
 
     Params& params();
-    const std::vector< Cols >& cols() const;
+    const ColumnArrays< Cols >& cols() const;
+    const std::vector< RowStatus >& rowStatus() const; ///< one entry per fetched row
 
     std::size_t fetchSize() const;
     void setFetchSize( const std::size_t fetchSize );
@@ -84,17 +350,76 @@ public:
     void exec();
     bool fetch();
 
+    bool pollExec(); ///< see Statement::pollExec
+    bool pollFetch( bool& result ); ///< see Statement::pollFetch
+
+    Status tryExec(); ///< see Statement::tryExec
+    Status tryFetch( bool& result ); ///< see Statement::tryFetch
+
 private:
     Statement stmt_;
     Params params_;
 
-    std::vector< Cols > cols_;
+    ColumnArrays< Cols > cols_;
+    std::array< const void*, ColumnArrays< Cols >::numberOfColumns > data_{};
+    std::size_t size_{ 0 };
+    std::size_t fetchSize_;
+
+    std::vector< RowStatus > rowStatus_;
+    long rowsFetched_;
+
+    void bindCols();
+};
+
+template< typename Params, typename Cols >
+class TypedStatement< Params, std::vector< Cols > > : private boost::noncopyable
+{
+    static_assert( !detail::hasDeferredColumns< Cols >(), "Deferred columns require fetching single rows." );
+
+public:
+    TypedStatement( Connection& conn, const char* const stmt, const std::size_t fetchSize, const CursorType cursorType = CursorType::ForwardOnly );
+
+    Params& params();
+    const FetchBuffer< Cols >& cols() const; ///< a FetchBuffer instead of a std::vector, see there
+    const FetchBuffer< RowStatus >& rowStatus() const; ///< one entry per fetched row
+
+    std::size_t fetchSize() const;
+    void setFetchSize( const std::size_t fetchSize );
+    void setAdaptiveFetchSize( const std::size_t maxBytes ); ///< tune the fetch size using previous executions and fetch latency within the given memory cap, disable using zero
+
+public:
+    void exec();
+    bool fetch();
+    bool fetchScroll( const FetchOrientation orientation, const long offset = 0 ); ///< fetch the row set at the given position, requires a scrollable cursor
+
+    bool pollExec(); ///< see Statement::pollExec
+    bool pollFetch( bool& result ); ///< see Statement::pollFetch
+
+    Status tryExec(); ///< see Statement::tryExec
+    Status tryFetch( bool& result ); ///< see Statement::tryFetch
+
+private:
+    Statement stmt_;
+    Params params_;
+
+    FetchBuffer< Cols > cols_;
+    FetchBuffer< RowStatus > rowStatus_;
+    std::size_t fetchSize_;
+    bool exhausted_{ false }; ///< whether the last row set was incomplete
+
     Cols* data_{ nullptr };
     std::size_t size_{ 0 };
 
+    bool bound_{ false }; ///< whether the binding plan was applied, afterwards only its pointers are updated
+
     long rowsFetched_;
 
+    detail::AdaptiveFetchSize adaptiveFetchSize_;
+
+    void reset();
     void bindCols();
+    bool fetched();
+    void adaptFetchSize();
 };
 
 }
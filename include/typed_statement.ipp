@@ -22,51 +22,290 @@ along with rodbc.  If not, see <http://www.gnu.org/licenses/>.
 
 #include "typed_statement.hpp"
 
+#include <boost/fusion/include/at_c.hpp>
 #include <boost/fusion/include/flatten.hpp>
 #include <boost/fusion/include/for_each.hpp>
 #include <boost/fusion/include/std_tuple.hpp>
+#include <boost/fusion/include/vector.hpp>
+#include <boost/fusion/include/zip_view.hpp>
+
+#include <new>
 
 namespace rodbc
 {
 namespace detail
 {
 
+template< typename Binder >
 struct ParamBinder
 {
-    Statement* const stmt;
+    Binder* const binder;
 
     template< typename Param >
     void operator() ( const Param& param ) const
     {
-        stmt->bindParam( param );
+        binder->bindParam( param );
     }
 };
 
+template< typename Binder, typename Params >
+inline void bindEachParam( Binder& binder, const Params& params )
+{
+    boost::fusion::for_each( boost::fusion::flatten( params ), ParamBinder< Binder >{ &binder } );
+}
+
 template< typename Params >
 inline void bindParams( Statement& stmt, const Params& params )
 {
     stmt.rebindParams();
-    boost::fusion::for_each( boost::fusion::flatten( params ), detail::ParamBinder{ &stmt } );
+    bindEachParam( stmt, params );
 }
 
+template< typename Binder >
 struct ColBinder
 {
-    Statement* const stmt;
+    Binder* const binder;
 
     template< typename Col >
     void operator() ( Col& col ) const
     {
-        stmt->bindCol( col );
+        binder->bindCol( col );
     }
 };
 
+template< typename Binder, typename Cols >
+inline void bindEachCol( Binder& binder, Cols& cols )
+{
+    boost::fusion::for_each( boost::fusion::flatten( cols ), ColBinder< Binder >{ &binder } );
+}
+
 template< typename Cols >
 inline void bindCols( Statement& stmt, Cols& cols )
 {
     stmt.rebindCols();
-    boost::fusion::for_each( boost::fusion::flatten( cols ), detail::ColBinder{ &stmt } );
+    bindEachCol( stmt, cols );
+}
+
+template< typename Params >
+inline const BindingPlan& paramsBindingPlan()
+{
+    static const BindingPlan plan = []()
+    {
+        BindingPlan plan;
+        const Params params{};
+
+        BindingRecorder recorder{ plan, &params, sizeof ( params ) };
+        bindEachParam( recorder, params );
+
+        return plan;
+    }();
+
+    return plan;
+}
+
+template< typename Cols >
+inline const BindingPlan& colsBindingPlan()
+{
+    static const BindingPlan plan = []()
+    {
+        BindingPlan plan;
+        Cols cols{};
+
+        BindingRecorder recorder{ plan, &cols, sizeof ( cols ) };
+        bindEachCol( recorder, cols );
+
+        return plan;
+    }();
+
+    return plan;
+}
+
+struct ColumnArrayResizer
+{
+    const std::size_t size;
+
+    template< typename ColumnArray >
+    void operator() ( ColumnArray& column ) const
+    {
+        column.resize( size );
+    }
+};
+
+struct ColumnArrayGetter
+{
+    const std::size_t index;
+
+    template< typename ColAndColumnArray >
+    void operator() ( const ColAndColumnArray& colAndColumnArray ) const
+    {
+        boost::fusion::at_c< 0 >( colAndColumnArray ) = boost::fusion::at_c< 1 >( colAndColumnArray ).get( index );
+    }
+};
+
+struct ColumnArraySetter
+{
+    const std::size_t index;
+
+    template< typename ColAndColumnArray >
+    void operator() ( const ColAndColumnArray& colAndColumnArray ) const
+    {
+        boost::fusion::at_c< 1 >( colAndColumnArray ).set( index, boost::fusion::at_c< 0 >( colAndColumnArray ) );
+    }
+};
+
+struct ColumnArrayDataCollector
+{
+    const void**& data;
+
+    template< typename ColumnArray >
+    void operator() ( const ColumnArray& column ) const
+    {
+        *data++ = column.data();
+    }
+};
+
+}
+
+template< typename Columns >
+inline std::size_t ColumnArrays< Columns >::size() const
+{
+    return std::get< 0 >( columns_ ).size();
+}
+
+template< typename Columns >
+inline void ColumnArrays< Columns >::resize( const std::size_t size )
+{
+    boost::fusion::for_each( columns_, detail::ColumnArrayResizer{ size } );
+}
+
+template< typename Columns >
+inline void ColumnArrays< Columns >::get( const std::size_t index, Columns& row ) const
+{
+    auto cols = boost::fusion::flatten( row );
+
+    using Zip = boost::fusion::vector< decltype( cols )&, const decltype( columns_ )& >;
+    boost::fusion::for_each( boost::fusion::zip_view< Zip >{ Zip{ cols, columns_ } }, detail::ColumnArrayGetter{ index } );
 }
 
+template< typename Columns >
+inline void ColumnArrays< Columns >::set( const std::size_t index, const Columns& row )
+{
+    const auto cols = boost::fusion::flatten( row );
+
+    using Zip = boost::fusion::vector< decltype( cols )&, decltype( columns_ )& >;
+    boost::fusion::for_each( boost::fusion::zip_view< Zip >{ Zip{ cols, columns_ } }, detail::ColumnArraySetter{ index } );
+}
+
+template< typename Columns >
+template< std::size_t Index >
+inline typename ColumnArrays< Columns >::template ColumnArrayAt< Index >& ColumnArrays< Columns >::column()
+{
+    return std::get< Index >( columns_ );
+}
+
+template< typename Columns >
+template< std::size_t Index >
+inline const typename ColumnArrays< Columns >::template ColumnArrayAt< Index >& ColumnArrays< Columns >::column() const
+{
+    return std::get< Index >( columns_ );
+}
+
+template< typename Type >
+inline FetchBuffer< Type >::~FetchBuffer()
+{
+    destroy();
+}
+
+template< typename Type >
+inline const Type* FetchBuffer< Type >::data() const
+{
+    return rows();
+}
+
+template< typename Type >
+inline const Type* FetchBuffer< Type >::begin() const
+{
+    return rows();
+}
+
+template< typename Type >
+inline const Type* FetchBuffer< Type >::end() const
+{
+    return rows() + size_;
+}
+
+template< typename Type >
+inline std::size_t FetchBuffer< Type >::size() const
+{
+    return size_;
+}
+
+template< typename Type >
+inline bool FetchBuffer< Type >::empty() const
+{
+    return size_ == 0;
+}
+
+template< typename Type >
+inline const Type& FetchBuffer< Type >::operator[] ( const std::size_t index ) const
+{
+    return rows()[ index ];
+}
+
+template< typename Type >
+inline const Type& FetchBuffer< Type >::front() const
+{
+    return rows()[ 0 ];
+}
+
+template< typename Type >
+inline const Type& FetchBuffer< Type >::back() const
+{
+    return rows()[ size_ - 1 ];
+}
+
+template< typename Type >
+inline Type* FetchBuffer< Type >::rows()
+{
+    return reinterpret_cast< Type* >( storage_.get() );
+}
+
+template< typename Type >
+inline const Type* FetchBuffer< Type >::rows() const
+{
+    return reinterpret_cast< const Type* >( storage_.get() );
+}
+
+template< typename Type >
+inline void FetchBuffer< Type >::reserve( const std::size_t capacity )
+{
+    if ( capacity_ < capacity )
+    {
+        destroy();
+
+        storage_.reset( new Storage[ capacity ] );
+        capacity_ = capacity;
+    }
+
+    size_ = 0;
+}
+
+template< typename Type >
+inline void FetchBuffer< Type >::construct( const std::size_t count )
+{
+    for ( ; constructed_ < count; ++constructed_ )
+    {
+        new ( rows() + constructed_ ) Type();
+    }
+}
+
+template< typename Type >
+inline void FetchBuffer< Type >::destroy()
+{
+    for ( ; constructed_ > 0; --constructed_ )
+    {
+        rows()[ constructed_ - 1 ].~Type();
+    }
 }
 
 template< typename Params, typename Cols >
@@ -74,7 +313,21 @@ inline TypedStatement< Params, Cols >::TypedStatement( Connection& conn, const c
 : stmt_{ conn, stmt }
 {
     detail::bindParams( stmt_, params_ );
-    detail::bindCols( stmt_, cols_ );
+
+    const auto& plan = detail::colsBindingPlan< Cols >();
+
+    if ( conn.shareDescriptors() && !plan.empty() && !plan.hasDeferredCols() )
+    {
+        desc_ = &conn.sharedDescriptor( typeid ( Cols ), plan );
+
+        stmt_.bindCols( *desc_ );
+    }
+    else
+    {
+        stmt_.bindCols( plan, &cols_ );
+    }
+
+    stmt_.bindRowStatus( &rowStatus_ );
 }
 
 template< typename Params, typename Cols >
@@ -89,18 +342,76 @@ inline const Cols& TypedStatement< Params, Cols >::cols() const
     return cols_;
 }
 
+template< typename Params, typename Cols >
+inline RowStatus TypedStatement< Params, Cols >::rowStatus() const
+{
+    return rowStatus_;
+}
+
 template< typename Params, typename Cols >
 inline void TypedStatement< Params, Cols >::exec()
 {
     stmt_.exec();
 }
 
+template< typename Params, typename Cols >
+inline long TypedStatement< Params, Cols >::rowCount() const
+{
+    return stmt_.rowCount();
+}
+
 template< typename Params, typename Cols >
 inline bool TypedStatement< Params, Cols >::fetch()
 {
+    pointDescriptor();
+
     return stmt_.fetch();
 }
 
+template< typename Params, typename Cols >
+inline bool TypedStatement< Params, Cols >::pollExec()
+{
+    return stmt_.pollExec();
+}
+
+template< typename Params, typename Cols >
+inline bool TypedStatement< Params, Cols >::pollFetch( bool& result )
+{
+    // Other statements could re-point the shared descriptor while this fetch is still executing.
+    if ( desc_ )
+    {
+        stmt_.resetRowDescriptor();
+        stmt_.bindCols( detail::colsBindingPlan< Cols >(), &cols_ );
+
+        desc_ = nullptr;
+    }
+
+    return stmt_.pollFetch( result );
+}
+
+template< typename Params, typename Cols >
+inline Status TypedStatement< Params, Cols >::tryExec()
+{
+    return stmt_.tryExec();
+}
+
+template< typename Params, typename Cols >
+inline Status TypedStatement< Params, Cols >::tryFetch( bool& result )
+{
+    pointDescriptor();
+
+    return stmt_.tryFetch( result );
+}
+
+template< typename Params, typename Cols >
+inline void TypedStatement< Params, Cols >::pointDescriptor()
+{
+    if ( desc_ )
+    {
+        desc_->point( &cols_ );
+    }
+}
+
 template< typename Params >
 inline TypedStatement< std::vector< Params >, std::tuple<> >::TypedStatement( Connection& conn, const char* const stmt )
 : stmt_{ conn, stmt }
@@ -113,42 +424,358 @@ inline std::vector< Params >& TypedStatement< std::vector< Params >, std::tuple<
     return params_;
 }
 
+template< typename Params >
+inline const std::vector< ParamStatus >& TypedStatement< std::vector< Params >, std::tuple<> >::paramStatus() const
+{
+    return status_.status();
+}
+
+template< typename Params >
+inline std::size_t TypedStatement< std::vector< Params >, std::tuple<> >::paramsProcessed() const
+{
+    return status_.processed();
+}
+
+template< typename Params >
+inline bool TypedStatement< std::vector< Params >, std::tuple<> >::continueOnError() const
+{
+    return status_.continueOnError();
+}
+
+template< typename Params >
+inline void TypedStatement< std::vector< Params >, std::tuple<> >::setContinueOnError( const bool continueOnError )
+{
+    status_.setContinueOnError( continueOnError );
+}
+
 template< typename Params >
 inline void TypedStatement< std::vector< Params >, std::tuple<> >::exec()
+{
+    exec( params_ );
+}
+
+template< typename Params >
+inline void TypedStatement< std::vector< Params >, std::tuple<> >::exec( const std::vector< Params >& params )
+{
+    bindParams( params );
+
+    status_.exec( stmt_ );
+}
+
+template< typename Params >
+inline bool TypedStatement< std::vector< Params >, std::tuple<> >::pollExec()
+{
+    bindParams( params_ );
+
+    return status_.pollExec( stmt_ );
+}
+
+template< typename Params >
+inline Status TypedStatement< std::vector< Params >, std::tuple<> >::tryExec()
+{
+    bindParams( params_ );
+
+    return status_.tryExec( stmt_ );
+}
+
+template< typename Params >
+inline long TypedStatement< std::vector< Params >, std::tuple<> >::rowCount() const
+{
+    return stmt_.rowCount();
+}
+
+template< typename Params >
+inline void TypedStatement< std::vector< Params >, std::tuple<> >::bindParams( const std::vector< Params >& params )
+{
+    const auto* const data = params.data();
+    const auto size = params.size();
+
+    // The plan is applied once and then only its data and indicator pointers follow a reallocated buffer.
+    if ( data_ != data )
+    {
+        if ( !bound_ )
+        {
+            stmt_.bindParams( detail::paramsBindingPlan< Params >(), data );
+
+            bound_ = true;
+        }
+        else
+        {
+            stmt_.pointParams( detail::paramsBindingPlan< Params >(), data );
+        }
+
+        data_ = data;
+    }
+
+    if ( size_ != size )
+    {
+        stmt_.bindParamArray( params );
+
+        size_ = size;
+    }
+
+    status_.bind( stmt_, size );
+}
+
+template< typename Params >
+inline TypedStatement< ColumnArrays< Params >, std::tuple<> >::TypedStatement( Connection& conn, const char* const stmt )
+: stmt_{ conn, stmt }
+{
+}
+
+template< typename Params >
+inline ColumnArrays< Params >& TypedStatement< ColumnArrays< Params >, std::tuple<> >::params()
+{
+    return params_;
+}
+
+template< typename Params >
+inline const std::vector< ParamStatus >& TypedStatement< ColumnArrays< Params >, std::tuple<> >::paramStatus() const
+{
+    return status_.status();
+}
+
+template< typename Params >
+inline std::size_t TypedStatement< ColumnArrays< Params >, std::tuple<> >::paramsProcessed() const
+{
+    return status_.processed();
+}
+
+template< typename Params >
+inline bool TypedStatement< ColumnArrays< Params >, std::tuple<> >::continueOnError() const
+{
+    return status_.continueOnError();
+}
+
+template< typename Params >
+inline void TypedStatement< ColumnArrays< Params >, std::tuple<> >::setContinueOnError( const bool continueOnError )
+{
+    status_.setContinueOnError( continueOnError );
+}
+
+template< typename Params >
+inline void TypedStatement< ColumnArrays< Params >, std::tuple<> >::exec()
 {
     bindParams();
 
-    stmt_.exec();
+    status_.exec( stmt_ );
+}
+
+template< typename Params >
+inline bool TypedStatement< ColumnArrays< Params >, std::tuple<> >::pollExec()
+{
+    bindParams();
+
+    return status_.pollExec( stmt_ );
+}
+
+template< typename Params >
+inline Status TypedStatement< ColumnArrays< Params >, std::tuple<> >::tryExec()
+{
+    bindParams();
+
+    return status_.tryExec( stmt_ );
 }
 
 template< typename Params >
-inline void TypedStatement< std::vector< Params >, std::tuple<> >::bindParams()
+inline long TypedStatement< ColumnArrays< Params >, std::tuple<> >::rowCount() const
 {
-    auto* const data = params_.data();
+    return stmt_.rowCount();
+}
+
+template< typename Params >
+inline void TypedStatement< ColumnArrays< Params >, std::tuple<> >::bindParams()
+{
+    decltype( data_ ) data;
+    auto* dataIt = data.data();
+    boost::fusion::for_each( params_.columns_, detail::ColumnArrayDataCollector{ dataIt } );
+
     const auto size = params_.size();
 
     if ( data_ != data )
     {
-        detail::bindParams( stmt_, *data );
+        detail::bindParams( stmt_, params_.columns_ );
 
         data_ = data;
     }
 
     if ( size_ != size )
     {
-        stmt_.bindParamArray( params_ );
+        stmt_.bindParamArrayByColumn( size );
 
         size_ = size;
     }
+
+    status_.bind( stmt_, size );
 }
 
 template< typename Params, typename Cols >
-inline TypedStatement< Params, std::vector< Cols > >::TypedStatement( Connection& conn, const char* const stmt, std::size_t fetchSize )
+inline TypedStatement< Params, ColumnArrays< Cols > >::TypedStatement( Connection& conn, const char* const stmt, const std::size_t fetchSize )
 : stmt_{ conn, stmt }
+, fetchSize_{ fetchSize }
+{
+    detail::bindParams( stmt_, params_ );
+}
+
+template< typename Params, typename Cols >
+inline Params& TypedStatement< Params, ColumnArrays< Cols > >::params()
+{
+    return params_;
+}
+
+template< typename Params, typename Cols >
+inline const ColumnArrays< Cols >& TypedStatement< Params, ColumnArrays< Cols > >::cols() const
+{
+    return cols_;
+}
+
+template< typename Params, typename Cols >
+inline const std::vector< RowStatus >& TypedStatement< Params, ColumnArrays< Cols > >::rowStatus() const
+{
+    return rowStatus_;
+}
+
+template< typename Params, typename Cols >
+inline std::size_t TypedStatement< Params, ColumnArrays< Cols > >::fetchSize() const
+{
+    return fetchSize_;
+}
+
+template< typename Params, typename Cols >
+inline void TypedStatement< Params, ColumnArrays< Cols > >::setFetchSize( const std::size_t fetchSize )
+{
+    fetchSize_ = fetchSize;
+}
+
+template< typename Params, typename Cols >
+inline void TypedStatement< Params, ColumnArrays< Cols > >::exec()
+{
+    cols_.resize( fetchSize_ );
+
+    bindCols();
+
+    stmt_.exec();
+}
+
+template< typename Params, typename Cols >
+inline bool TypedStatement< Params, ColumnArrays< Cols > >::fetch()
+{
+    if ( cols_.size() != fetchSize_ || !stmt_.fetch() )
+    {
+        return false;
+    }
+
+    cols_.resize( rowsFetched_ );
+    rowStatus_.resize( rowsFetched_ );
+
+    return rowsFetched_ != 0;
+}
+
+template< typename Params, typename Cols >
+inline bool TypedStatement< Params, ColumnArrays< Cols > >::pollExec()
+{
+    cols_.resize( fetchSize_ );
+
+    bindCols();
+
+    return stmt_.pollExec();
+}
+
+template< typename Params, typename Cols >
+inline bool TypedStatement< Params, ColumnArrays< Cols > >::pollFetch( bool& result )
+{
+    if ( cols_.size() != fetchSize_ )
+    {
+        result = false;
+
+        return true;
+    }
+
+    if ( !stmt_.pollFetch( result ) )
+    {
+        return false;
+    }
+
+    if ( result )
+    {
+        cols_.resize( rowsFetched_ );
+        rowStatus_.resize( rowsFetched_ );
+
+        result = rowsFetched_ != 0;
+    }
+
+    return true;
+}
+
+template< typename Params, typename Cols >
+inline Status TypedStatement< Params, ColumnArrays< Cols > >::tryExec()
+{
+    cols_.resize( fetchSize_ );
+
+    bindCols();
+
+    return stmt_.tryExec();
+}
+
+template< typename Params, typename Cols >
+inline Status TypedStatement< Params, ColumnArrays< Cols > >::tryFetch( bool& result )
+{
+    if ( cols_.size() != fetchSize_ )
+    {
+        result = false;
+
+        return {};
+    }
+
+    const auto status = stmt_.tryFetch( result );
+
+    if ( result )
+    {
+        cols_.resize( rowsFetched_ );
+        rowStatus_.resize( rowsFetched_ );
+
+        result = rowsFetched_ != 0;
+    }
+
+    return status;
+}
+
+template< typename Params, typename Cols >
+inline void TypedStatement< Params, ColumnArrays< Cols > >::bindCols()
+{
+    decltype( data_ ) data;
+    auto* dataIt = data.data();
+    boost::fusion::for_each( cols_.columns_, detail::ColumnArrayDataCollector{ dataIt } );
+
+    const auto size = cols_.size();
+
+    if ( data_ != data )
+    {
+        detail::bindCols( stmt_, cols_.columns_ );
+
+        data_ = data;
+    }
+
+    rowStatus_.resize( size );
+
+    if ( size_ != size )
+    {
+        stmt_.bindColArrayByColumn( size, rowsFetched_ );
+        stmt_.bindRowStatus( rowStatus_.data() );
+
+        size_ = size;
+    }
+}
+
+template< typename Params, typename Cols >
+inline TypedStatement< Params, std::vector< Cols > >::TypedStatement( Connection& conn, const char* const stmt, const std::size_t fetchSize, const CursorType cursorType )
+: stmt_{ conn, stmt, cursorType }
+, fetchSize_{ fetchSize }
 {
     detail::bindParams( stmt_, params_ );
 
     cols_.reserve( fetchSize );
+    rowStatus_.reserve( fetchSize );
 }
 
 template< typename Params, typename Cols >
@@ -158,29 +785,49 @@ inline Params& TypedStatement< Params, std::vector< Cols > >::params()
 }
 
 template< typename Params, typename Cols >
-const std::vector< Cols >& TypedStatement< Params, std::vector< Cols > >::cols() const
+const FetchBuffer< Cols >& TypedStatement< Params, std::vector< Cols > >::cols() const
 {
     return cols_;
 }
 
+template< typename Params, typename Cols >
+inline const FetchBuffer< RowStatus >& TypedStatement< Params, std::vector< Cols > >::rowStatus() const
+{
+    return rowStatus_;
+}
+
 template< typename Params, typename Cols >
 inline std::size_t TypedStatement< Params, std::vector< Cols > >::fetchSize() const
 {
-    return cols_.capacity();
+    return fetchSize_;
 }
 
 template< typename Params, typename Cols >
 inline void TypedStatement< Params, std::vector< Cols > >::setFetchSize( const std::size_t fetchSize )
 {
+    fetchSize_ = fetchSize;
+
     cols_.reserve( fetchSize );
+    rowStatus_.reserve( fetchSize );
+}
+
+template< typename Params, typename Cols >
+inline void TypedStatement< Params, std::vector< Cols > >::setAdaptiveFetchSize( const std::size_t maxBytes )
+{
+    adaptiveFetchSize_.setMaxRows( maxBytes != 0 ? std::max< std::size_t >( maxBytes / sizeof ( Cols ), 1 ) : 0 );
 }
 
 template< typename Params, typename Cols >
 inline void TypedStatement< Params, std::vector< Cols > >::exec()
 {
-    cols_.resize( cols_.capacity() );
+    if ( adaptiveFetchSize_.enabled() )
+    {
+        adaptiveFetchSize_.exec();
 
-    bindCols();
+        adaptFetchSize();
+    }
+
+    reset();
 
     stmt_.exec();
 }
@@ -188,34 +835,176 @@ inline void TypedStatement< Params, std::vector< Cols > >::exec()
 template< typename Params, typename Cols >
 inline bool TypedStatement< Params, std::vector< Cols > >::fetch()
 {
-    if ( cols_.size() != cols_.capacity() || !stmt_.fetch() )
+    if ( exhausted_ )
     {
         return false;
     }
 
-    cols_.resize( rowsFetched_ );
+    if ( !adaptiveFetchSize_.enabled() )
+    {
+        if ( !stmt_.fetch() )
+        {
+            return false;
+        }
+    }
+    else
+    {
+        if ( adaptiveFetchSize_.fetchSize() != fetchSize_ )
+        {
+            adaptFetchSize();
 
-    return rowsFetched_ != 0;
+            bindCols();
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+
+        if ( !stmt_.fetch() )
+        {
+            return false;
+        }
+
+        adaptiveFetchSize_.fetched( rowsFetched_, fetchSize_, std::chrono::steady_clock::now() - start );
+    }
+
+    return fetched();
+}
+
+template< typename Params, typename Cols >
+inline bool TypedStatement< Params, std::vector< Cols > >::fetchScroll( const FetchOrientation orientation, const long offset )
+{
+    reset();
+
+    if ( !stmt_.fetchScroll( orientation, offset ) )
+    {
+        return false;
+    }
+
+    return fetched();
+}
+
+template< typename Params, typename Cols >
+inline bool TypedStatement< Params, std::vector< Cols > >::pollExec()
+{
+    reset();
+
+    return stmt_.pollExec();
+}
+
+template< typename Params, typename Cols >
+inline bool TypedStatement< Params, std::vector< Cols > >::pollFetch( bool& result )
+{
+    if ( exhausted_ )
+    {
+        result = false;
+
+        return true;
+    }
+
+    if ( !stmt_.pollFetch( result ) )
+    {
+        return false;
+    }
+
+    if ( result )
+    {
+        result = fetched();
+    }
+
+    return true;
+}
+
+template< typename Params, typename Cols >
+inline Status TypedStatement< Params, std::vector< Cols > >::tryExec()
+{
+    reset();
+
+    return stmt_.tryExec();
+}
+
+template< typename Params, typename Cols >
+inline Status TypedStatement< Params, std::vector< Cols > >::tryFetch( bool& result )
+{
+    if ( exhausted_ )
+    {
+        result = false;
+
+        return {};
+    }
+
+    const auto status = stmt_.tryFetch( result );
+
+    if ( result )
+    {
+        result = fetched();
+    }
+
+    return status;
+}
+
+template< typename Params, typename Cols >
+inline void TypedStatement< Params, std::vector< Cols > >::reset()
+{
+    cols_.size_ = 0;
+    rowStatus_.size_ = 0;
+
+    exhausted_ = false;
+
+    bindCols();
 }
 
 template< typename Params, typename Cols >
 inline void TypedStatement< Params, std::vector< Cols > >::bindCols()
 {
-    auto* const data = cols_.data();
-    const auto size = cols_.size();
+    cols_.construct( fetchSize_ );
+    rowStatus_.construct( fetchSize_ );
+
+    auto* const data = cols_.rows();
 
     if ( data_ != data )
     {
-        detail::bindCols( stmt_, *data );
-
-        data_ = data;
+        if ( !bound_ )
+        {
+            stmt_.bindCols( detail::colsBindingPlan< Cols >(), data );
+
+            bound_ = true;
+        }
+        else
+        {
+            stmt_.pointCols( detail::colsBindingPlan< Cols >(), data );
+        }
     }
 
-    if ( size_ != size )
+    // Growing the fetch size reallocates the row status as well.
+    if ( data_ != data || size_ != fetchSize_ )
     {
-        stmt_.bindColArray( cols_, rowsFetched_ );
+        stmt_.bindColArray< Cols >( fetchSize_, rowsFetched_ );
+        stmt_.bindRowStatus( rowStatus_.rows() );
 
-        size_ = size;
+        size_ = fetchSize_;
+    }
+
+    data_ = data;
+}
+
+template< typename Params, typename Cols >
+inline bool TypedStatement< Params, std::vector< Cols > >::fetched()
+{
+    cols_.size_ = rowsFetched_;
+    rowStatus_.size_ = rowsFetched_;
+
+    exhausted_ = cols_.size_ != fetchSize_;
+
+    return rowsFetched_ != 0;
+}
+
+template< typename Params, typename Cols >
+inline void TypedStatement< Params, std::vector< Cols > >::adaptFetchSize()
+{
+    const auto fetchSize = adaptiveFetchSize_.fetchSize();
+
+    if ( fetchSize != fetchSize_ )
+    {
+        setFetchSize( fetchSize );
     }
 }
 
@@ -20,6 +20,7 @@ along with rodbc.  If not, see <http://www.gnu.org/licenses/>.
 */
 #pragma once
 
+#include <boost/container/vector.hpp>
 #include <boost/mpl/accumulate.hpp>
 #include <boost/mpl/range_c.hpp>
 #include <boost/multiprecision/cpp_int.hpp>
@@ -40,11 +41,13 @@ class Exception : public std::exception
 {
 public:
     Exception( const short type, void* const handle );
+    Exception( const char* const state, std::string message );
 
     const char* state() const noexcept;
     int nativeError() const noexcept;
 
     bool isTimeout() const noexcept;
+    bool isCancelled() const noexcept;
     bool isConstraintViolation() const noexcept;
 
     const char* what() const noexcept override;
@@ -55,6 +58,44 @@ private:
     std::string message_;
 };
 
+/**
+ * @brief The Status class
+ *
+ * Describes the outcome of a non-throwing call without allocating, the diagnostic message is only retrieved on request.
+ */
+class Status
+{
+public:
+    Status();
+
+    bool ok() const noexcept;
+    explicit operator bool() const noexcept;
+
+    const char* state() const noexcept; ///< the full SQLSTATE, its first two characters give the class
+    int nativeError() const noexcept;
+
+    bool isTimeout() const noexcept;
+    bool isCancelled() const noexcept;
+    bool isConstraintViolation() const noexcept;
+
+    std::string message() const; ///< only available until the next call on the originating handle
+    void raise() const; ///< throw the corresponding exception unless ok
+
+private:
+    Status( const short type, void* const handle );
+    Status( const char* const state, const char* const message ); ///< a failure detected without calling the driver
+
+    char state_[ 5 + 1 ];
+    int nativeError_;
+
+    short type_;
+    void* handle_;
+    const char* message_;
+
+    friend class Statement;
+    template< typename Derived > friend class Binder;
+};
+
 /**
  * @brief The String class template
  */
@@ -76,6 +117,8 @@ public:
     bool isNull() const;
     void clear();
 
+    bool isTruncated() const; ///< the fetched value was longer than Size
+
 public:
     std::string str() const;
     const char* c_str() const;
@@ -87,8 +130,12 @@ private:
     char val_[ Size + 1 ];
     long ind_;
 
+    long length() const;
+
     friend class Statement;
+    template< typename Derived > friend class Binder;
     template< std::size_t Size_ > friend class Number;
+    template< typename Type_ > friend class ColumnArray;
     template< std::size_t Size_ > friend bool operator== ( const String< Size_ >& lhs, const String< Size_ >& rhs );
     template< std::size_t Size_ > friend bool operator!= ( const String< Size_ >& lhs, const String< Size_ >& rhs );
     template< std::size_t Size_ > friend bool operator< ( const String< Size_ >& lhs, const String< Size_ >& rhs );
@@ -141,12 +188,71 @@ private:
     String< Size > val_;
 
     friend class Statement;
+    template< typename Derived > friend class Binder;
+    template< typename Type_ > friend class ColumnArray;
     template< std::size_t Size_ > friend std::ostream& operator<< ( std::ostream& stream, const Number< Size_ >& number );
     template< class Key > friend struct std::hash;
 };
 
 template< std::size_t Size > std::ostream& operator<< ( std::ostream& stream, const Number< Size >& number );
 
+/**
+ * @brief The Blob class template
+ */
+template< std::size_t Size >
+class Blob
+{
+public:
+    Blob();
+
+    Blob( const Blob& );
+    Blob& operator= ( const Blob& );
+
+    Blob( const void* const data, const std::size_t size );
+    void assign( const void* const data, const std::size_t size );
+
+    explicit Blob( const std::string& );
+    Blob& operator= ( const std::string& );
+
+    bool isNull() const;
+    void clear();
+
+    bool isTruncated() const; ///< the fetched value was longer than Size
+
+public:
+    const char* data() const;
+    std::size_t size() const;
+
+    std::string str() const;
+
+    const char* begin() const;
+    const char* end() const;
+
+private:
+    char val_[ Size ];
+    long ind_;
+
+    long length() const;
+
+    friend class Statement;
+    template< typename Derived > friend class Binder;
+    template< typename Type_ > friend class ColumnArray;
+    template< std::size_t Size_ > friend bool operator== ( const Blob< Size_ >& lhs, const Blob< Size_ >& rhs );
+    template< std::size_t Size_ > friend bool operator!= ( const Blob< Size_ >& lhs, const Blob< Size_ >& rhs );
+    template< std::size_t Size_ > friend bool operator< ( const Blob< Size_ >& lhs, const Blob< Size_ >& rhs );
+    template< std::size_t Size_ > friend bool operator<= ( const Blob< Size_ >& lhs, const Blob< Size_ >& rhs );
+    template< std::size_t Size_ > friend bool operator> ( const Blob< Size_ >& lhs, const Blob< Size_ >& rhs );
+    template< std::size_t Size_ > friend bool operator>= ( const Blob< Size_ >& lhs, const Blob< Size_ >& rhs );
+    template< class Key > friend struct std::hash;
+};
+
+template< std::size_t Size > bool operator== ( const Blob< Size >& lhs, const Blob< Size >& rhs );
+template< std::size_t Size > bool operator!= ( const Blob< Size >& lhs, const Blob< Size >& rhs );
+template< std::size_t Size > bool operator< ( const Blob< Size >& lhs, const Blob< Size >& rhs );
+template< std::size_t Size > bool operator<= ( const Blob< Size >& lhs, const Blob< Size >& rhs );
+template< std::size_t Size > bool operator> ( const Blob< Size >& lhs, const Blob< Size >& rhs );
+template< std::size_t Size > bool operator>= ( const Blob< Size >& lhs, const Blob< Size >& rhs );
+
 /**
  * @brief The Timestamp struct
  */
@@ -197,6 +303,41 @@ private:
     long ind_;
 
     friend class Statement;
+    template< typename Derived > friend class Binder;
+    template< typename Type_ > friend bool operator== ( const Nullable< Type_ >& lhs, const Nullable< Type_ >& rhs );
+    template< typename Type_ > friend bool operator!= ( const Nullable< Type_ >& lhs, const Nullable< Type_ >& rhs );
+    template< class Key > friend struct std::hash;
+};
+
+/**
+ * @brief The Nullable class template specialization for Blob
+ *
+ * A Blob carries its own indicator which is also used to represent null values.
+ */
+template< std::size_t Size >
+class Nullable< Blob< Size > >
+{
+public:
+    Nullable() = default;
+    Nullable( const Blob< Size >& val );
+
+    Nullable( const Nullable& ) = default;
+    Nullable& operator= ( const Nullable& ) = default;
+
+    bool isNull() const;
+    void clear();
+
+public:
+    Blob< Size >* value();
+    const Blob< Size >* value() const;
+
+    Blob< Size > value( const Blob< Size >& defVal ) const;
+
+private:
+    Blob< Size > val_;
+
+    friend class Statement;
+    template< typename Derived > friend class Binder;
     template< typename Type_ > friend bool operator== ( const Nullable< Type_ >& lhs, const Nullable< Type_ >& rhs );
     template< typename Type_ > friend bool operator!= ( const Nullable< Type_ >& lhs, const Nullable< Type_ >& rhs );
     template< class Key > friend struct std::hash;
@@ -207,6 +348,153 @@ template< typename Type > bool operator!= ( const Nullable< Type >& lhs, const N
 
 template< typename Type > std::ostream& operator<< ( std::ostream& stream, const Nullable< Type >& nullable );
 
+/**
+ * @brief The LongParam class
+ *
+ * Streams a large text or binary parameter in chunks during execution instead of binding a buffer holding the whole value.
+ */
+class LongParam
+{
+public:
+    using Source = std::function< std::size_t ( char* const data, const std::size_t size ) >; ///< fills at most size bytes and returns their number, zero at the end
+
+    LongParam( const bool binary = false );
+    LongParam( Source source, const bool binary = false );
+
+    bool isNull() const;
+    void clear();
+
+    bool isBinary() const;
+
+public:
+    const Source& source() const;
+    void setSource( Source source );
+
+private:
+    Source source_;
+    long ind_;
+    bool binary_;
+
+    friend class Statement;
+    template< typename Derived > friend class Binder;
+};
+
+/**
+ * @brief The ColumnArray class template
+ *
+ * Stores the values of a single column contiguously for column-wise binding of parameter sets and row sets.
+ */
+template< typename Type >
+class ColumnArray
+{
+public:
+    std::size_t size() const;
+    void resize( const std::size_t size );
+
+    Type* data();
+    const Type* data() const;
+
+public:
+    Type get( const std::size_t index ) const;
+    void set( const std::size_t index, const Type& val );
+
+private:
+    boost::container::vector< Type > val_;
+};
+
+template< typename Type >
+class ColumnArray< Nullable< Type > >
+{
+public:
+    std::size_t size() const;
+    void resize( const std::size_t size );
+
+    Type* data();
+    const Type* data() const;
+
+    long* indicators();
+    const long* indicators() const;
+
+public:
+    Nullable< Type > get( const std::size_t index ) const;
+    void set( const std::size_t index, const Nullable< Type >& val );
+
+private:
+    boost::container::vector< Type > val_;
+    boost::container::vector< long > ind_;
+};
+
+template< std::size_t Size >
+class ColumnArray< String< Size > >
+{
+public:
+    static constexpr std::size_t stride = Size + 1;
+
+    std::size_t size() const;
+    void resize( const std::size_t size );
+
+    char* data();
+    const char* data() const;
+
+    long* indicators();
+    const long* indicators() const;
+
+public:
+    String< Size > get( const std::size_t index ) const;
+    void set( const std::size_t index, const String< Size >& val );
+
+private:
+    boost::container::vector< char > val_;
+    boost::container::vector< long > ind_;
+};
+
+template< std::size_t Size >
+class ColumnArray< Number< Size > >
+{
+public:
+    static constexpr std::size_t stride = Size + 1;
+
+    std::size_t size() const;
+    void resize( const std::size_t size );
+
+    char* data();
+    const char* data() const;
+
+    long* indicators();
+    const long* indicators() const;
+
+public:
+    Number< Size > get( const std::size_t index ) const;
+    void set( const std::size_t index, const Number< Size >& val );
+
+private:
+    ColumnArray< String< Size > > val_;
+};
+
+template< std::size_t Size >
+class ColumnArray< Blob< Size > >
+{
+public:
+    static constexpr std::size_t stride = Size;
+
+    std::size_t size() const;
+    void resize( const std::size_t size );
+
+    char* data();
+    const char* data() const;
+
+    long* indicators();
+    const long* indicators() const;
+
+public:
+    Blob< Size > get( const std::size_t index ) const;
+    void set( const std::size_t index, const Blob< Size >& val );
+
+private:
+    boost::container::vector< char > val_;
+    boost::container::vector< long > ind_;
+};
+
 template< std::size_t... Indices >
 struct IndexSequence
 {
@@ -57,7 +57,7 @@ inline String< Size >::String()
 template< std::size_t Size >
 inline String< Size >::String( const String& that )
 {
-    detail::assign( val_, ind_, that.val_, that.ind_ );
+    detail::assign( val_, ind_, that.val_, that.length() );
 }
 
 template< std::size_t Size >
@@ -68,7 +68,7 @@ inline String< Size >& String< Size >::operator= ( const String& that )
         return *this;
     }
 
-    detail::assign( val_, ind_, that.val_, that.ind_ );
+    detail::assign( val_, ind_, that.val_, that.length() );
 
     return *this;
 }
@@ -113,16 +113,22 @@ inline void String< Size >::clear()
     ind_ = -1;
 }
 
+template< std::size_t Size >
+inline bool String< Size >::isTruncated() const
+{
+    return ind_ > static_cast< long >( Size );
+}
+
 template< std::size_t Size >
 inline std::string String< Size >::str() const
 {
-    return detail::str( val_, ind_ );
+    return detail::str( val_, length() );
 }
 
 template< std::size_t Size >
 inline const char* String< Size >::c_str() const
 {
-    return detail::c_str( const_cast< char* >( val_ ), ind_ );
+    return detail::c_str( const_cast< char* >( val_ ), length() );
 }
 
 template< std::size_t Size >
@@ -134,13 +140,19 @@ inline const char* String< Size >::begin() const
 template< std::size_t Size >
 inline const char* String< Size >::end() const
 {
-    return val_ + std::max( ind_, 0l );
+    return val_ + std::max( length(), 0l );
+}
+
+template< std::size_t Size >
+inline long String< Size >::length() const
+{
+    return std::min( ind_, static_cast< long >( Size ) );
 }
 
 template< std::size_t Size >
 inline bool operator== ( const String< Size >& lhs, const String< Size >& rhs )
 {
-    return detail::compare( lhs.val_, lhs.ind_, rhs.val_, rhs.ind_ ) == 0;
+    return detail::compare( lhs.val_, lhs.length(), rhs.val_, rhs.length() ) == 0;
 }
 
 template< std::size_t Size >
@@ -152,13 +164,13 @@ inline bool operator!= ( const String< Size >& lhs, const String< Size >& rhs )
 template< std::size_t Size >
 inline bool operator< ( const String< Size >& lhs, const String< Size >& rhs )
 {
-    return detail::compare( lhs.val_, lhs.ind_, rhs.val_, rhs.ind_ ) < 0;
+    return detail::compare( lhs.val_, lhs.length(), rhs.val_, rhs.length() ) < 0;
 }
 
 template< std::size_t Size >
 inline bool operator<= ( const String< Size >& lhs, const String< Size >& rhs )
 {
-    return detail::compare( lhs.val_, lhs.ind_, rhs.val_, rhs.ind_ ) <= 0;
+    return detail::compare( lhs.val_, lhs.length(), rhs.val_, rhs.length() ) <= 0;
 }
 
 template< std::size_t Size >
@@ -184,6 +196,152 @@ inline std::ostream& operator<< ( std::ostream& stream, const String< Size >& st
     return stream;
 }
 
+template< std::size_t Size >
+inline Blob< Size >::Blob()
+: ind_{ -1 }
+{
+}
+
+template< std::size_t Size >
+inline Blob< Size >::Blob( const Blob& that )
+{
+    detail::assign( val_, ind_, that.val_, that.length() );
+}
+
+template< std::size_t Size >
+inline Blob< Size >& Blob< Size >::operator= ( const Blob& that )
+{
+    if ( this == &that )
+    {
+        return *this;
+    }
+
+    detail::assign( val_, ind_, that.val_, that.length() );
+
+    return *this;
+}
+
+template< std::size_t Size >
+inline Blob< Size >::Blob( const void* const data, const std::size_t size )
+{
+    assign( data, size );
+}
+
+template< std::size_t Size >
+inline void Blob< Size >::assign( const void* const data, const std::size_t size )
+{
+    if ( size > Size )
+    {
+        throw std::range_error{ "Value is too large for blob." };
+    }
+
+    detail::assign( val_, ind_, static_cast< const char* >( data ), size );
+}
+
+template< std::size_t Size >
+inline Blob< Size >::Blob( const std::string& val )
+{
+    assign( val.data(), val.size() );
+}
+
+template< std::size_t Size >
+inline Blob< Size >& Blob< Size >::operator= ( const std::string& val )
+{
+    assign( val.data(), val.size() );
+
+    return *this;
+}
+
+template< std::size_t Size >
+inline bool Blob< Size >::isNull() const
+{
+    return ind_ < 0;
+}
+
+template< std::size_t Size >
+inline void Blob< Size >::clear()
+{
+    ind_ = -1;
+}
+
+template< std::size_t Size >
+inline bool Blob< Size >::isTruncated() const
+{
+    return ind_ > static_cast< long >( Size );
+}
+
+template< std::size_t Size >
+inline const char* Blob< Size >::data() const
+{
+    return val_;
+}
+
+template< std::size_t Size >
+inline std::size_t Blob< Size >::size() const
+{
+    return std::max( length(), 0l );
+}
+
+template< std::size_t Size >
+inline std::string Blob< Size >::str() const
+{
+    return detail::str( val_, length() );
+}
+
+template< std::size_t Size >
+inline const char* Blob< Size >::begin() const
+{
+    return val_;
+}
+
+template< std::size_t Size >
+inline const char* Blob< Size >::end() const
+{
+    return val_ + size();
+}
+
+template< std::size_t Size >
+inline long Blob< Size >::length() const
+{
+    return std::min( ind_, static_cast< long >( Size ) );
+}
+
+template< std::size_t Size >
+inline bool operator== ( const Blob< Size >& lhs, const Blob< Size >& rhs )
+{
+    return detail::compare( lhs.val_, lhs.length(), rhs.val_, rhs.length() ) == 0;
+}
+
+template< std::size_t Size >
+inline bool operator!= ( const Blob< Size >& lhs, const Blob< Size >& rhs )
+{
+    return !( lhs == rhs );
+}
+
+template< std::size_t Size >
+inline bool operator< ( const Blob< Size >& lhs, const Blob< Size >& rhs )
+{
+    return detail::compare( lhs.val_, lhs.length(), rhs.val_, rhs.length() ) < 0;
+}
+
+template< std::size_t Size >
+inline bool operator<= ( const Blob< Size >& lhs, const Blob< Size >& rhs )
+{
+    return detail::compare( lhs.val_, lhs.length(), rhs.val_, rhs.length() ) <= 0;
+}
+
+template< std::size_t Size >
+inline bool operator> ( const Blob< Size >& lhs, const Blob< Size >& rhs )
+{
+    return rhs < lhs;
+}
+
+template< std::size_t Size >
+inline bool operator>= ( const Blob< Size >& lhs, const Blob< Size >& rhs )
+{
+    return rhs <= lhs;
+}
+
 template< std::size_t Size >
 inline Number< Size >::Number( const boost::multiprecision::cpp_int& val )
 {
@@ -306,10 +464,46 @@ Type Nullable< Type >::value( const Type& defVal ) const
     return ind_ < 0 ? defVal : val_;
 }
 
+template< std::size_t Size >
+inline Nullable< Blob< Size > >::Nullable( const Blob< Size >& val )
+: val_{ val }
+{
+}
+
+template< std::size_t Size >
+inline bool Nullable< Blob< Size > >::isNull() const
+{
+    return val_.isNull();
+}
+
+template< std::size_t Size >
+void Nullable< Blob< Size > >::clear()
+{
+    val_.clear();
+}
+
+template< std::size_t Size >
+inline Blob< Size >* Nullable< Blob< Size > >::value()
+{
+    return val_.isNull() ? nullptr : &val_;
+}
+
+template< std::size_t Size >
+inline const Blob< Size >* Nullable< Blob< Size > >::value() const
+{
+    return val_.isNull() ? nullptr : &val_;
+}
+
+template< std::size_t Size >
+Blob< Size > Nullable< Blob< Size > >::value( const Blob< Size >& defVal ) const
+{
+    return val_.isNull() ? defVal : val_;
+}
+
 template< typename Type >
 inline bool operator== ( const Nullable< Type >& lhs, const Nullable< Type >& rhs )
 {
-    if ( lhs.ind_ < 0 || rhs.ind_ < 0 )
+    if ( lhs.isNull() || rhs.isNull() )
     {
         return false;
     }
@@ -334,6 +528,262 @@ inline std::ostream& operator<< ( std::ostream& stream, const Nullable< Type >&
     return stream;
 }
 
+template< typename Type >
+inline std::size_t ColumnArray< Type >::size() const
+{
+    return val_.size();
+}
+
+template< typename Type >
+inline void ColumnArray< Type >::resize( const std::size_t size )
+{
+    val_.resize( size );
+}
+
+template< typename Type >
+inline Type* ColumnArray< Type >::data()
+{
+    return val_.data();
+}
+
+template< typename Type >
+inline const Type* ColumnArray< Type >::data() const
+{
+    return val_.data();
+}
+
+template< typename Type >
+inline Type ColumnArray< Type >::get( const std::size_t index ) const
+{
+    return val_[ index ];
+}
+
+template< typename Type >
+inline void ColumnArray< Type >::set( const std::size_t index, const Type& val )
+{
+    val_[ index ] = val;
+}
+
+template< typename Type >
+inline std::size_t ColumnArray< Nullable< Type > >::size() const
+{
+    return ind_.size();
+}
+
+template< typename Type >
+inline void ColumnArray< Nullable< Type > >::resize( const std::size_t size )
+{
+    val_.resize( size );
+    ind_.resize( size, -1 );
+}
+
+template< typename Type >
+inline Type* ColumnArray< Nullable< Type > >::data()
+{
+    return val_.data();
+}
+
+template< typename Type >
+inline const Type* ColumnArray< Nullable< Type > >::data() const
+{
+    return val_.data();
+}
+
+template< typename Type >
+inline long* ColumnArray< Nullable< Type > >::indicators()
+{
+    return ind_.data();
+}
+
+template< typename Type >
+inline const long* ColumnArray< Nullable< Type > >::indicators() const
+{
+    return ind_.data();
+}
+
+template< typename Type >
+inline Nullable< Type > ColumnArray< Nullable< Type > >::get( const std::size_t index ) const
+{
+    if ( ind_[ index ] < 0 )
+    {
+        return {};
+    }
+
+    return { val_[ index ] };
+}
+
+template< typename Type >
+inline void ColumnArray< Nullable< Type > >::set( const std::size_t index, const Nullable< Type >& val )
+{
+    if ( const auto* const value = val.value() )
+    {
+        val_[ index ] = *value;
+        ind_[ index ] = sizeof( Type );
+    }
+    else
+    {
+        ind_[ index ] = -1;
+    }
+}
+
+template< std::size_t Size >
+inline std::size_t ColumnArray< String< Size > >::size() const
+{
+    return ind_.size();
+}
+
+template< std::size_t Size >
+inline void ColumnArray< String< Size > >::resize( const std::size_t size )
+{
+    val_.resize( size * stride );
+    ind_.resize( size, -1 );
+}
+
+template< std::size_t Size >
+inline char* ColumnArray< String< Size > >::data()
+{
+    return val_.data();
+}
+
+template< std::size_t Size >
+inline const char* ColumnArray< String< Size > >::data() const
+{
+    return val_.data();
+}
+
+template< std::size_t Size >
+inline long* ColumnArray< String< Size > >::indicators()
+{
+    return ind_.data();
+}
+
+template< std::size_t Size >
+inline const long* ColumnArray< String< Size > >::indicators() const
+{
+    return ind_.data();
+}
+
+template< std::size_t Size >
+inline String< Size > ColumnArray< String< Size > >::get( const std::size_t index ) const
+{
+    String< Size > val;
+
+    detail::assign( val.val_, val.ind_, val_.data() + index * stride, std::min( ind_[ index ], static_cast< long >( Size ) ) );
+
+    return val;
+}
+
+template< std::size_t Size >
+inline void ColumnArray< String< Size > >::set( const std::size_t index, const String< Size >& val )
+{
+    detail::assign( val_.data() + index * stride, ind_[ index ], val.val_, val.ind_ );
+}
+
+template< std::size_t Size >
+inline std::size_t ColumnArray< Number< Size > >::size() const
+{
+    return val_.size();
+}
+
+template< std::size_t Size >
+inline void ColumnArray< Number< Size > >::resize( const std::size_t size )
+{
+    val_.resize( size );
+}
+
+template< std::size_t Size >
+inline char* ColumnArray< Number< Size > >::data()
+{
+    return val_.data();
+}
+
+template< std::size_t Size >
+inline const char* ColumnArray< Number< Size > >::data() const
+{
+    return val_.data();
+}
+
+template< std::size_t Size >
+inline long* ColumnArray< Number< Size > >::indicators()
+{
+    return val_.indicators();
+}
+
+template< std::size_t Size >
+inline const long* ColumnArray< Number< Size > >::indicators() const
+{
+    return val_.indicators();
+}
+
+template< std::size_t Size >
+inline Number< Size > ColumnArray< Number< Size > >::get( const std::size_t index ) const
+{
+    Number< Size > val;
+
+    val.val_ = val_.get( index );
+
+    return val;
+}
+
+template< std::size_t Size >
+inline void ColumnArray< Number< Size > >::set( const std::size_t index, const Number< Size >& val )
+{
+    val_.set( index, val.val_ );
+}
+
+template< std::size_t Size >
+inline std::size_t ColumnArray< Blob< Size > >::size() const
+{
+    return ind_.size();
+}
+
+template< std::size_t Size >
+inline void ColumnArray< Blob< Size > >::resize( const std::size_t size )
+{
+    val_.resize( size * stride );
+    ind_.resize( size, -1 );
+}
+
+template< std::size_t Size >
+inline char* ColumnArray< Blob< Size > >::data()
+{
+    return val_.data();
+}
+
+template< std::size_t Size >
+inline const char* ColumnArray< Blob< Size > >::data() const
+{
+    return val_.data();
+}
+
+template< std::size_t Size >
+inline long* ColumnArray< Blob< Size > >::indicators()
+{
+    return ind_.data();
+}
+
+template< std::size_t Size >
+inline const long* ColumnArray< Blob< Size > >::indicators() const
+{
+    return ind_.data();
+}
+
+template< std::size_t Size >
+inline Blob< Size > ColumnArray< Blob< Size > >::get( const std::size_t index ) const
+{
+    Blob< Size > val;
+
+    detail::assign( val.val_, val.ind_, val_.data() + index * stride, std::min( ind_[ index ], static_cast< long >( Size ) ) );
+
+    return val;
+}
+
+template< std::size_t Size >
+inline void ColumnArray< Blob< Size > >::set( const std::size_t index, const Blob< Size >& val )
+{
+    detail::assign( val_.data() + index * stride, ind_[ index ], val.val_, val.length() );
+}
+
 }
 
 namespace std
@@ -347,7 +797,19 @@ struct hash< rodbc::String< Size > >
 
     result_type operator() ( const argument_type& val ) const
     {
-        return rodbc::detail::hash( val.val_, val.ind_ );
+        return rodbc::detail::hash( val.val_, val.length() );
+    }
+};
+
+template< std::size_t Size >
+struct hash< rodbc::Blob< Size > >
+{
+    using argument_type = rodbc::Blob< Size >;
+    using result_type = std::size_t;
+
+    result_type operator() ( const argument_type& val ) const
+    {
+        return rodbc::detail::hash( val.val_, val.length() );
     }
 };
 
@@ -371,7 +833,7 @@ struct hash< rodbc::Nullable< Type > >
 
     result_type operator() ( const argument_type& val ) const
     {
-        return val.ind_ < 0 ? 0 : std::hash< Type >{}( val.val_ );
+        return val.isNull() ? 0 : std::hash< Type >{}( val.val_ );
     }
 };
 
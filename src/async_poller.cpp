@@ -0,0 +1,93 @@
+/*
+
+Copyright 2017 Adam Reichold
+
+This file is part of rodbc.
+
+rodbc is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+rodbc is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with rodbc.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#include "async_poller.hpp"
+
+#include <algorithm>
+
+namespace rodbc
+{
+
+AsyncPoller::AsyncPoller( const std::chrono::microseconds interval )
+: interval_{ interval }
+, done_{ false }
+, thread_{ &AsyncPoller::run, this }
+{
+}
+
+AsyncPoller::~AsyncPoller()
+{
+    {
+        std::unique_lock< std::mutex > lock{ lock_ };
+
+        done_ = true;
+    }
+
+    condition_.notify_one();
+
+    thread_.join();
+}
+
+void AsyncPoller::post( Poll poll )
+{
+    {
+        std::unique_lock< std::mutex > lock{ lock_ };
+
+        pending_.push_back( std::move( poll ) );
+    }
+
+    condition_.notify_one();
+}
+
+void AsyncPoller::run()
+{
+    std::vector< Poll > active;
+
+    std::unique_lock< std::mutex > lock{ lock_ };
+
+    for ( ;; )
+    {
+        if ( active.empty() )
+        {
+            condition_.wait( lock, [ this ]() { return done_ || !pending_.empty(); } );
+        }
+
+        std::move( pending_.begin(), pending_.end(), std::back_inserter( active ) );
+        pending_.clear();
+
+        if ( active.empty() )
+        {
+            return;
+        }
+
+        lock.unlock();
+
+        active.erase( std::remove_if( active.begin(), active.end(), []( const Poll& poll ) { return poll(); } ), active.end() );
+
+        lock.lock();
+
+        if ( !active.empty() )
+        {
+            condition_.wait_for( lock, interval_ );
+        }
+    }
+}
+
+}
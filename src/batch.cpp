@@ -0,0 +1,125 @@
+/*
+
+Copyright 2017 Adam Reichold
+
+This file is part of rodbc.
+
+rodbc is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+rodbc is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with rodbc.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#include "batch.hpp"
+
+#include "connection.hpp"
+
+namespace rodbc
+{
+namespace detail
+{
+
+BatchStatementBase::BatchStatementBase( std::string stmt )
+: stmt_{ std::move( stmt ) }
+{
+}
+
+BatchStatementBase::~BatchStatementBase() = default;
+
+void BatchStatementBase::exec( Connection& conn )
+{
+    if ( !ownStmt_ )
+    {
+        ownStmt_.reset( new Statement{ conn, stmt_.c_str() } );
+
+        bindParams( *ownStmt_ );
+    }
+
+    ownStmt_->exec();
+
+    fetch( *ownStmt_ );
+}
+
+}
+
+Batch::Batch( Connection& conn )
+: Batch{ conn, conn.supportsBatches() }
+{
+}
+
+Batch::Batch( Connection& conn, const bool batched )
+: conn_( conn )
+, batched_{ batched && conn.supportsBatches() }
+{
+}
+
+bool Batch::batched() const
+{
+    return batched_;
+}
+
+void Batch::exec()
+{
+    if ( !batched_ )
+    {
+        for ( const auto& stmt : stmts_ )
+        {
+            stmt->exec( conn_ );
+        }
+
+        return;
+    }
+
+    if ( stmts_.empty() )
+    {
+        return;
+    }
+
+    if ( !stmt_ )
+    {
+        std::string stmt;
+
+        for ( const auto& batchStmt : stmts_ )
+        {
+            if ( !stmt.empty() )
+            {
+                stmt += "; ";
+            }
+
+            stmt += batchStmt->stmt_;
+        }
+
+        stmt_.reset( new Statement{ conn_, stmt.c_str() } );
+
+        for ( const auto& batchStmt : stmts_ )
+        {
+            batchStmt->bindParams( *stmt_ );
+        }
+    }
+
+    stmt_->exec();
+
+    for ( auto batchStmt = stmts_.begin(); batchStmt != stmts_.end(); ++batchStmt )
+    {
+        if ( batchStmt != stmts_.begin() && !stmt_->moreResults() )
+        {
+            throw Exception{ "HY000", "Batch yielded fewer results than it has statements." };
+        }
+
+        ( *batchStmt )->fetch( *stmt_ );
+    }
+
+    while ( stmt_->moreResults() )
+    {
+    }
+}
+
+}
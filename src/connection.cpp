@@ -20,6 +20,7 @@ along with rodbc.  If not, see <http://www.gnu.org/licenses/>.
 */
 #include "connection.hpp"
 
+#include "statement.hpp"
 #include "types.hpp"
 
 #include <sql.h>
@@ -27,6 +28,8 @@ along with rodbc.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <boost/algorithm/string/predicate.hpp>
 
+#include <cstring>
+
 namespace rodbc
 {
 namespace
@@ -73,14 +76,24 @@ Environment& Environment::operator= ( Environment&& that ) noexcept
 }
 
 Connection::Connection( Environment& env, const char* const connStr )
+: lazyPrepare_{ false }
+, shareDescriptors_{ false }
+, bindValidation_{ BindValidation::Off }
 {
     check( ::SQLAllocHandle( SQL_HANDLE_DBC, env.env_, &dbc_ ), SQL_HANDLE_ENV, env.env_ );
     check( ::SQLDriverConnect( dbc_, nullptr, (SQLCHAR*) connStr, SQL_NTS, nullptr, 0, 0, SQL_DRIVER_COMPLETE_REQUIRED ), SQL_HANDLE_DBC, dbc_ );
     check( ::SQLSetConnectAttr( dbc_, SQL_ATTR_AUTOCOMMIT, (SQLPOINTER) SQL_AUTOCOMMIT_OFF, 0 ), SQL_HANDLE_DBC, dbc_ );
+
+    handles_ = std::make_shared< StatementHandles >( dbc_ );
 }
 
 Connection::~Connection()
 {
+    descriptors_.clear();
+
+    // Statements which outlive the connection only hold a weak reference and will free their handles themselves.
+    handles_.reset();
+
     if ( dbc_ )
     {
         ::SQLFreeHandle( SQL_HANDLE_DBC, dbc_ );
@@ -90,6 +103,11 @@ Connection::~Connection()
 }
 
 Connection::Connection( Connection&& that ) noexcept
+: lazyPrepare_{ that.lazyPrepare_ }
+, shareDescriptors_{ that.shareDescriptors_ }
+, descriptors_{ std::move( that.descriptors_ ) }
+, bindValidation_{ that.bindValidation_ }
+, handles_{ std::move( that.handles_ ) }
 {
     dbc_ = that.dbc_;
     that.dbc_ = nullptr;
@@ -99,10 +117,24 @@ Connection& Connection::operator= ( Connection&& that ) noexcept
 {
     std::swap( dbc_, that.dbc_ );
 
+    lazyPrepare_ = that.lazyPrepare_;
+
+    shareDescriptors_ = that.shareDescriptors_;
+    std::swap( descriptors_, that.descriptors_ );
+
+    bindValidation_ = that.bindValidation_;
+
+    std::swap( handles_, that.handles_ );
+
     return* this;
 }
 
 DBMS Connection::dbms() const
+{
+    return handles_->dbms();
+}
+
+DBMS StatementHandles::dbms() const
 {
     if ( dbms_ )
     {
@@ -128,6 +160,10 @@ DBMS Connection::dbms() const
     {
         dbms_ = DBMS::MySQL;
     }
+    else if ( boost::icontains( name, "SQL Server" ) )
+    {
+        dbms_ = DBMS::SQLServer;
+    }
     else
     {
         dbms_ = DBMS::Other;
@@ -136,6 +172,93 @@ DBMS Connection::dbms() const
     return *dbms_;
 }
 
+bool Connection::supportsBatches() const
+{
+    if ( batches_ )
+    {
+        return *batches_;
+    }
+
+    SQLUINTEGER batchSupport = 0;
+    SQLUINTEGER batchRowCount = 0;
+    char multResultSets[ 2 ] = "N";
+
+    // Drivers which do not report these information types are assumed not to support batches.
+    const auto reported = SQL_SUCCEEDED( ::SQLGetInfo( dbc_, SQL_BATCH_SUPPORT, &batchSupport, sizeof ( batchSupport ), nullptr ) )
+        && SQL_SUCCEEDED( ::SQLGetInfo( dbc_, SQL_BATCH_ROW_COUNT, &batchRowCount, sizeof ( batchRowCount ), nullptr ) )
+        && SQL_SUCCEEDED( ::SQLGetInfo( dbc_, SQL_MULT_RESULT_SETS, multResultSets, sizeof ( multResultSets ), nullptr ) );
+
+    batches_ = reported
+        && ( batchSupport & SQL_BS_SELECT_EXPLICIT ) && ( batchSupport & SQL_BS_ROW_COUNT_EXPLICIT )
+        && !( batchRowCount & SQL_BRC_ROLLED_UP )
+        && multResultSets[ 0 ] == 'Y';
+
+    return *batches_;
+}
+
+InsertStrategy Connection::insertStrategy() const
+{
+    if ( insertStrategy_ )
+    {
+        return *insertStrategy_;
+    }
+
+    char driverOdbcVer[ 6 ] = "02.00";
+    SQLUINTEGER paramArrayRowCounts;
+
+    ::SQLGetInfo( dbc_, SQL_DRIVER_ODBC_VER, driverOdbcVer, sizeof ( driverOdbcVer ), nullptr );
+
+    const auto nativeParamArrays = std::strncmp( driverOdbcVer, "03", 2 ) >= 0
+        && SQL_SUCCEEDED( ::SQLGetInfo( dbc_, SQL_PARAM_ARRAY_ROW_COUNTS, &paramArrayRowCounts, sizeof ( paramArrayRowCounts ), nullptr ) );
+
+    insertStrategy_ = !nativeParamArrays && bulkOperationsCursor() != CursorType::ForwardOnly
+        ? InsertStrategy::BulkOperations : InsertStrategy::ParamArrays;
+
+    return *insertStrategy_;
+}
+
+void Connection::setInsertStrategy( const InsertStrategy insertStrategy )
+{
+    insertStrategy_ = insertStrategy;
+}
+
+CursorType Connection::bulkOperationsCursor() const
+{
+    if ( bulkOperationsCursor_ )
+    {
+        return *bulkOperationsCursor_;
+    }
+
+    bulkOperationsCursor_ = CursorType::ForwardOnly;
+
+    SQLUSMALLINT bulkOperations = SQL_FALSE;
+    ::SQLGetFunctions( dbc_, SQL_API_SQLBULKOPERATIONS, &bulkOperations );
+
+    if ( bulkOperations == SQL_TRUE )
+    {
+        const std::pair< SQLUSMALLINT, CursorType > cursors[] = {
+            { SQL_KEYSET_CURSOR_ATTRIBUTES1, CursorType::Keyset },
+            { SQL_STATIC_CURSOR_ATTRIBUTES1, CursorType::Static },
+            { SQL_DYNAMIC_CURSOR_ATTRIBUTES1, CursorType::Dynamic }
+        };
+
+        for ( const auto& cursor : cursors )
+        {
+            SQLUINTEGER attributes = 0;
+            ::SQLGetInfo( dbc_, cursor.first, &attributes, sizeof ( attributes ), nullptr );
+
+            if ( attributes & SQL_CA1_BULK_ADD )
+            {
+                bulkOperationsCursor_ = cursor.second;
+
+                break;
+            }
+        }
+    }
+
+    return *bulkOperationsCursor_;
+}
+
 IsolationLevel Connection::isolationLevel() const
 {
     SQLUINTEGER txnIsolation;
@@ -208,6 +331,148 @@ bool Connection::isDead() const
     return dead != SQL_CD_FALSE;
 }
 
+Connection::Clock::time_point Connection::deadline() const
+{
+    return handles_->deadline;
+}
+
+void Connection::setDeadline( const Clock::time_point deadline )
+{
+    handles_->deadline = deadline;
+}
+
+bool Connection::lazyPrepare() const
+{
+    return lazyPrepare_;
+}
+
+void Connection::setLazyPrepare( const bool lazyPrepare )
+{
+    lazyPrepare_ = lazyPrepare;
+}
+
+const PrepareStatistics& Connection::prepareStatistics() const
+{
+    return handles_->prepareStatistics;
+}
+
+bool Connection::shareDescriptors() const
+{
+    return shareDescriptors_;
+}
+
+void Connection::setShareDescriptors( const bool shareDescriptors )
+{
+    shareDescriptors_ = shareDescriptors;
+}
+
+SharedDescriptor& Connection::sharedDescriptor( const std::type_info& type, const BindingPlan& plan )
+{
+    auto& desc = descriptors_[ type ];
+
+    if ( !desc )
+    {
+        desc.reset( new SharedDescriptor{ *this, plan } );
+    }
+
+    return *desc;
+}
+
+BindValidation Connection::bindValidation() const
+{
+    return bindValidation_;
+}
+
+void Connection::setBindValidation( const BindValidation bindValidation )
+{
+    bindValidation_ = bindValidation;
+}
+
+const std::vector< BindMismatch >& Connection::bindMismatches() const
+{
+    return handles_->bindMismatches;
+}
+
+void Connection::clearBindMismatches()
+{
+    handles_->bindMismatches.clear();
+}
+
+std::size_t Connection::recycledHandles() const
+{
+    return handles_->recycled();
+}
+
+void Connection::setMaxRecycledHandles( const std::size_t maxRecycledHandles )
+{
+    handles_->setMaxRecycled( maxRecycledHandles );
+}
+
+StatementHandles::StatementHandles( void* const dbc )
+: dbc_{ dbc }
+, maxRecycled_{ 8 }
+{
+    handles_.reserve( maxRecycled_ );
+}
+
+StatementHandles::~StatementHandles()
+{
+    for ( const auto stmt : handles_ )
+    {
+        ::SQLFreeHandle( SQL_HANDLE_STMT, stmt );
+    }
+}
+
+std::size_t StatementHandles::recycled() const
+{
+    return handles_.size();
+}
+
+void StatementHandles::setMaxRecycled( const std::size_t maxRecycled )
+{
+    maxRecycled_ = maxRecycled;
+
+    while ( handles_.size() > maxRecycled_ )
+    {
+        ::SQLFreeHandle( SQL_HANDLE_STMT, handles_.back() );
+
+        handles_.pop_back();
+    }
+
+    handles_.reserve( maxRecycled_ );
+}
+
+void* StatementHandles::acquire()
+{
+    if ( !handles_.empty() )
+    {
+        const auto stmt = handles_.back();
+        handles_.pop_back();
+
+        return stmt;
+    }
+
+    void* stmt;
+    check( ::SQLAllocHandle( SQL_HANDLE_STMT, dbc_, &stmt ), SQL_HANDLE_DBC, dbc_ );
+
+    return stmt;
+}
+
+void StatementHandles::recycle( void* const stmt )
+{
+    if ( handles_.size() < maxRecycled_
+        && SQL_SUCCEEDED( ::SQLFreeStmt( stmt, SQL_CLOSE ) )
+        && SQL_SUCCEEDED( ::SQLFreeStmt( stmt, SQL_UNBIND ) )
+        && SQL_SUCCEEDED( ::SQLFreeStmt( stmt, SQL_RESET_PARAMS ) ) )
+    {
+        handles_.push_back( stmt );
+
+        return;
+    }
+
+    ::SQLFreeHandle( SQL_HANDLE_STMT, stmt );
+}
+
 Transaction::Transaction( Connection& conn )
 : dbc_{ conn.dbc_ }
 {
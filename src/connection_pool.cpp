@@ -29,6 +29,7 @@ namespace detail
 
 ConnectionPoolBase::ConnectionPoolBase( std::string connStr )
 : connStr_{ std::move( connStr ) }
+, lazyPrepare_{ false }
 {
 }
 
@@ -38,7 +39,18 @@ Connection ConnectionPoolBase::makeConnection()
 {
     boost::unique_lock< boost::mutex > lock{ env_lock_ };
 
-    return { env_, connStr_.c_str() };
+    Connection conn{ env_, connStr_.c_str() };
+
+    conn.setLazyPrepare( lazyPrepare_ );
+
+    return conn;
+}
+
+void ConnectionPoolBase::setLazyPrepare( const bool lazyPrepare )
+{
+    boost::unique_lock< boost::mutex > lock{ env_lock_ };
+
+    lazyPrepare_ = lazyPrepare;
 }
 
 ConnectionPoolHolderBase::~ConnectionPoolHolderBase() = default;
@@ -0,0 +1,302 @@
+/*
+
+Copyright 2017 Adam Reichold
+
+This file is part of rodbc.
+
+rodbc is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+rodbc is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with rodbc.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#include "dynamic_statement.hpp"
+
+#include <sql.h>
+#include <sqlext.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace rodbc
+{
+namespace
+{
+
+constexpr std::size_t alignment = sizeof ( std::uint64_t );
+
+constexpr std::size_t maxBytesPerCharacter = 4;
+
+inline std::size_t align( const std::size_t offset )
+{
+    return ( offset + alignment - 1 ) / alignment * alignment;
+}
+
+inline DynamicStatement::CellType cellType( const ColumnDescription& col )
+{
+    switch ( col.type )
+    {
+    case SQL_BIT:
+    case SQL_TINYINT:
+    case SQL_SMALLINT:
+    case SQL_INTEGER:
+    case SQL_BIGINT:
+        return DynamicStatement::CellType::Integer;
+    case SQL_REAL:
+    case SQL_FLOAT:
+    case SQL_DOUBLE:
+        return DynamicStatement::CellType::Real;
+    case SQL_BINARY:
+    case SQL_VARBINARY:
+    case SQL_LONGVARBINARY:
+        return DynamicStatement::CellType::Binary;
+    case SQL_TYPE_DATE:
+    case SQL_TYPE_TIMESTAMP:
+        return DynamicStatement::CellType::Timestamp;
+    default:
+        return DynamicStatement::CellType::Text;
+    }
+}
+
+inline SQLSMALLINT cType( const DynamicStatement::CellType type )
+{
+    switch ( type )
+    {
+    case DynamicStatement::CellType::Integer:
+        return SQL_C_SBIGINT;
+    case DynamicStatement::CellType::Real:
+        return SQL_C_DOUBLE;
+    case DynamicStatement::CellType::Binary:
+        return SQL_C_BINARY;
+    case DynamicStatement::CellType::Timestamp:
+        return SQL_C_TIMESTAMP;
+    default:
+        return SQL_C_CHAR;
+    }
+}
+
+inline std::size_t cellLength( const DynamicStatement::CellType type, const std::size_t size, const std::size_t maxLength )
+{
+    switch ( type )
+    {
+    case DynamicStatement::CellType::Integer:
+        return sizeof ( std::int64_t );
+    case DynamicStatement::CellType::Real:
+        return sizeof ( double );
+    case DynamicStatement::CellType::Binary:
+        return size != 0 ? std::min( size, maxLength ) : maxLength;
+    case DynamicStatement::CellType::Timestamp:
+        return sizeof ( SQL_TIMESTAMP_STRUCT );
+    default:
+        // Column sizes are given in characters which take up to four bytes each when encoded as UTF-8.
+        return ( size != 0 ? std::min( maxBytesPerCharacter * size, maxLength ) : maxLength ) + 1;
+    }
+}
+
+static_assert( sizeof ( Timestamp ) == sizeof ( SQL_TIMESTAMP_STRUCT ), "Size of timestamp and ODBC timestamp structure must match." );
+
+}
+
+DynamicStatement::DynamicStatement( Connection& conn, const char* const stmt, const std::size_t fetchSize, const Layout layout, const std::size_t maxLength )
+: stmt_{ conn, stmt }
+, cols_{ stmt_.describeCols() }
+{
+    std::size_t offset = 0;
+
+    for ( const auto& col : cols_ )
+    {
+        const auto type = rodbc::cellType( col );
+        const auto length = cellLength( type, col.size, maxLength );
+
+        Cell cell{ type, length, 0, 0 };
+
+        switch ( layout )
+        {
+        case Layout::RowWise:
+            cell.value = offset;
+            cell.indicator = offset = align( offset + length );
+            offset += sizeof ( long );
+            break;
+        case Layout::ColumnWise:
+            cell.value = offset;
+            cell.indicator = offset = align( offset + length * fetchSize );
+            offset = align( offset + sizeof ( long ) * fetchSize );
+            break;
+        }
+
+        cells_.push_back( cell );
+    }
+
+    stride_ = layout == Layout::RowWise ? align( offset ) : 0;
+
+    const auto size = layout == Layout::RowWise ? stride_ * fetchSize : offset;
+    arena_.resize( std::max< std::size_t >( size / alignment, 1 ) );
+
+    auto* const data = reinterpret_cast< char* >( arena_.data() );
+
+    for ( const auto& cell : cells_ )
+    {
+        stmt_.bindCol( data + cell.value, cType( cell.type ), cell.length, reinterpret_cast< long* >( data + cell.indicator ) );
+    }
+
+    switch ( layout )
+    {
+    case Layout::RowWise:
+        stmt_.bindColArrayByRow( stride_, fetchSize, rowsFetched_ );
+        break;
+    case Layout::ColumnWise:
+        stmt_.bindColArrayByColumn( fetchSize, rowsFetched_ );
+        break;
+    }
+}
+
+Statement& DynamicStatement::params()
+{
+    return stmt_;
+}
+
+const std::vector< ColumnDescription >& DynamicStatement::cols() const
+{
+    return cols_;
+}
+
+DynamicStatement::CellType DynamicStatement::cellType( const std::size_t col ) const
+{
+    return cells_.at( col ).type;
+}
+
+std::size_t DynamicStatement::rows() const
+{
+    return rowsFetched_;
+}
+
+bool DynamicStatement::isNull( const std::size_t row, const std::size_t col ) const
+{
+    return indicator( row, cells_.at( col ) ) == SQL_NULL_DATA;
+}
+
+bool DynamicStatement::isTruncated( const std::size_t row, const std::size_t col ) const
+{
+    const auto& cell = cells_.at( col );
+
+    if ( cell.type != CellType::Text && cell.type != CellType::Binary )
+    {
+        return false;
+    }
+
+    const auto ind = indicator( row, cell );
+
+    return ind == SQL_NO_TOTAL || ( ind >= 0 && static_cast< std::size_t >( ind ) > capacity( cell ) );
+}
+
+template<>
+std::int64_t DynamicStatement::get< std::int64_t >( const std::size_t row, const std::size_t col ) const
+{
+    std::int64_t val;
+    std::memcpy( &val, value( row, cell( col, CellType::Integer ) ), sizeof ( val ) );
+
+    return val;
+}
+
+template<>
+double DynamicStatement::get< double >( const std::size_t row, const std::size_t col ) const
+{
+    double val;
+    std::memcpy( &val, value( row, cell( col, CellType::Real ) ), sizeof ( val ) );
+
+    return val;
+}
+
+template<>
+std::string DynamicStatement::get< std::string >( const std::size_t row, const std::size_t col ) const
+{
+    const auto& cell = cells_.at( col );
+
+    if ( cell.type != CellType::Text && cell.type != CellType::Binary )
+    {
+        throw std::invalid_argument{ "Cell type does not match requested type." };
+    }
+
+    const auto ind = indicator( row, cell );
+
+    if ( ind == SQL_NULL_DATA )
+    {
+        return {};
+    }
+
+    const auto length = ind < 0 ? capacity( cell ) : std::min< std::size_t >( ind, capacity( cell ) );
+
+    return { value( row, cell ), length };
+}
+
+template<>
+Timestamp DynamicStatement::get< Timestamp >( const std::size_t row, const std::size_t col ) const
+{
+    Timestamp val;
+    std::memcpy( &val, value( row, cell( col, CellType::Timestamp ) ), sizeof ( val ) );
+
+    return val;
+}
+
+void DynamicStatement::exec()
+{
+    rowsFetched_ = 0;
+
+    stmt_.exec();
+}
+
+bool DynamicStatement::fetch()
+{
+    if ( !stmt_.fetch() )
+    {
+        rowsFetched_ = 0;
+
+        return false;
+    }
+
+    return rowsFetched_ != 0;
+}
+
+const char* DynamicStatement::value( const std::size_t row, const Cell& cell ) const
+{
+    const auto* const data = reinterpret_cast< const char* >( arena_.data() );
+
+    return data + cell.value + row * ( stride_ != 0 ? stride_ : cell.length );
+}
+
+long DynamicStatement::indicator( const std::size_t row, const Cell& cell ) const
+{
+    const auto* const data = reinterpret_cast< const char* >( arena_.data() );
+
+    long ind;
+    std::memcpy( &ind, data + cell.indicator + row * ( stride_ != 0 ? stride_ : sizeof ( long ) ), sizeof ( ind ) );
+
+    return ind;
+}
+
+std::size_t DynamicStatement::capacity( const Cell& cell ) const
+{
+    return cell.type == CellType::Text ? cell.length - 1 : cell.length;
+}
+
+const DynamicStatement::Cell& DynamicStatement::cell( const std::size_t col, const CellType type ) const
+{
+    const auto& cell = cells_.at( col );
+
+    if ( cell.type != type )
+    {
+        throw std::invalid_argument{ "Cell type does not match requested type." };
+    }
+
+    return cell;
+}
+
+}
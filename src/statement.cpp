@@ -25,6 +25,19 @@ along with rodbc.  If not, see <http://www.gnu.org/licenses/>.
 #include <sql.h>
 #include <sqlext.h>
 
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+
+#include <unistd.h>
+
 namespace rodbc
 {
 namespace
@@ -40,6 +53,191 @@ inline SQLRETURN check( const SQLRETURN rc, const SQLSMALLINT type, const SQLHAN
     return rc;
 }
 
+inline bool failed( const SQLRETURN rc )
+{
+    return !SQL_SUCCEEDED( rc ) && rc != SQL_NO_DATA;
+}
+
+constexpr std::size_t chunkSize = 16 * 1024;
+
+constexpr const char* deadlineExpired = "Deadline expired before execution.";
+
+/**
+ * @brief Polls until done, yielding at first and then sleeping for exponentially increasing periods
+ */
+template< typename Poll >
+inline void waitUntil( const Poll& poll )
+{
+    constexpr int yields = 16;
+    constexpr std::chrono::microseconds maxDelay{ 10 * 1000 };
+
+    std::chrono::microseconds delay{ 50 };
+
+    for ( int attempt = 0; !poll(); ++attempt )
+    {
+        if ( attempt < yields )
+        {
+            std::this_thread::yield();
+
+            continue;
+        }
+
+        std::this_thread::sleep_for( delay );
+
+        delay = std::min( 2 * delay, maxDelay );
+    }
+}
+
+constexpr SQLSMALLINT deferredType = 0; ///< marks recorded bindings of deferred columns
+
+enum class TypeFamily
+{
+    Integer,
+    Approximate,
+    Decimal,
+    Character,
+    Binary,
+    Temporal,
+    Other
+};
+
+struct TypeClass
+{
+    TypeFamily family;
+    int rank; ///< orders the types of a family by their range or precision
+};
+
+inline TypeClass classify( const SQLSMALLINT type )
+{
+    switch ( type )
+    {
+    case SQL_BIT:
+    case SQL_TINYINT:
+        return { TypeFamily::Integer, 1 };
+    case SQL_SMALLINT:
+        return { TypeFamily::Integer, 2 };
+    case SQL_INTEGER:
+        return { TypeFamily::Integer, 3 };
+    case SQL_BIGINT:
+        return { TypeFamily::Integer, 4 };
+    case SQL_REAL:
+        return { TypeFamily::Approximate, 1 };
+    case SQL_FLOAT:
+    case SQL_DOUBLE:
+        return { TypeFamily::Approximate, 2 };
+    case SQL_NUMERIC:
+    case SQL_DECIMAL:
+        return { TypeFamily::Decimal, 0 };
+    case SQL_CHAR:
+    case SQL_VARCHAR:
+    case SQL_LONGVARCHAR:
+    case SQL_WCHAR:
+    case SQL_WVARCHAR:
+    case SQL_WLONGVARCHAR:
+        return { TypeFamily::Character, 0 };
+    case SQL_BINARY:
+    case SQL_VARBINARY:
+    case SQL_LONGVARBINARY:
+        return { TypeFamily::Binary, 0 };
+    case SQL_TYPE_DATE:
+    case SQL_TYPE_TIME:
+        return { TypeFamily::Temporal, 1 };
+    case SQL_TIMESTAMP:
+    case SQL_TYPE_TIMESTAMP:
+        return { TypeFamily::Temporal, 2 };
+    default:
+        return { TypeFamily::Other, 0 };
+    }
+}
+
+inline SQLSMALLINT sqlTypeOf( const SQLSMALLINT cType )
+{
+    switch ( cType )
+    {
+    case SQL_C_BIT:
+    case SQL_C_STINYINT:
+    case SQL_C_UTINYINT:
+        return SQL_TINYINT;
+    case SQL_C_SSHORT:
+    case SQL_C_USHORT:
+        return SQL_SMALLINT;
+    case SQL_C_SLONG:
+    case SQL_C_ULONG:
+        return SQL_INTEGER;
+    case SQL_C_SBIGINT:
+    case SQL_C_UBIGINT:
+        return SQL_BIGINT;
+    case SQL_C_FLOAT:
+        return SQL_REAL;
+    case SQL_C_DOUBLE:
+        return SQL_DOUBLE;
+    case SQL_C_TIMESTAMP:
+        return SQL_TYPE_TIMESTAMP;
+    case SQL_C_CHAR:
+        return SQL_VARCHAR;
+    case SQL_C_BINARY:
+        return SQL_VARBINARY;
+    default:
+        return SQL_UNKNOWN_TYPE;
+    }
+}
+
+/**
+ * @brief Whether converting values of the given types can lose precision or truncate them
+ *
+ * Sizes are given in characters or bytes where zero means unbounded.
+ */
+inline bool isLossy( const SQLSMALLINT from, const std::size_t fromSize, const SQLSMALLINT to, const std::size_t toSize )
+{
+    const auto source = classify( from );
+    const auto target = classify( to );
+
+    switch ( target.family )
+    {
+    case TypeFamily::Integer:
+        return source.family == TypeFamily::Approximate || source.family == TypeFamily::Decimal || ( source.family == TypeFamily::Integer && source.rank > target.rank );
+    case TypeFamily::Approximate:
+        return source.family == TypeFamily::Decimal || ( source.family == TypeFamily::Approximate && source.rank > target.rank );
+    case TypeFamily::Decimal:
+        return source.family == TypeFamily::Approximate;
+    case TypeFamily::Character:
+    case TypeFamily::Binary:
+        return source.family == target.family && toSize != 0 && ( fromSize == 0 || fromSize > toSize );
+    case TypeFamily::Temporal:
+        return source.family == TypeFamily::Temporal && source.rank > target.rank;
+    default:
+        return false;
+    }
+}
+
+/**
+ * @brief Whether the server has to convert a parameter of the bound type to compare it with the described type
+ *
+ * Such conversions can prevent the use of indexes even if no precision is lost.
+ */
+inline bool isConverted( const SQLSMALLINT bound, const SQLSMALLINT described )
+{
+    const auto source = classify( bound );
+    const auto target = classify( described );
+
+    if ( source.family == TypeFamily::Other || target.family == TypeFamily::Other )
+    {
+        return false;
+    }
+
+    return source.family != target.family || source.rank != target.rank;
+}
+
+/**
+ * @brief Whether the driver describes parameters by the types they are compared with
+ *
+ * The MySQL and SQLite drivers describe every parameter as SQL_VARCHAR.
+ */
+inline bool describesParams( const DBMS dbms )
+{
+    return dbms != DBMS::MySQL && dbms != DBMS::SQLite;
+}
+
 template< typename Type >
 struct OdbcTraits;
 
@@ -73,22 +271,312 @@ DEF_ODBC_TRAITS( Timestamp, SQL_TIMESTAMP_STRUCT, SQL_C_TIMESTAMP, SQL_TIMESTAMP
 
 #undef DEF_ODBC_TRAITS
 
+static_assert( static_cast< SQLUSMALLINT >( ParamStatus::Success ) == SQL_PARAM_SUCCESS, "Parameter status must match ODBC definition." );
+static_assert( static_cast< SQLUSMALLINT >( ParamStatus::SuccessWithInfo ) == SQL_PARAM_SUCCESS_WITH_INFO, "Parameter status must match ODBC definition." );
+static_assert( static_cast< SQLUSMALLINT >( ParamStatus::Error ) == SQL_PARAM_ERROR, "Parameter status must match ODBC definition." );
+static_assert( static_cast< SQLUSMALLINT >( ParamStatus::Unused ) == SQL_PARAM_UNUSED, "Parameter status must match ODBC definition." );
+static_assert( static_cast< SQLUSMALLINT >( ParamStatus::DiagnosticsUnavailable ) == SQL_PARAM_DIAG_UNAVAILABLE, "Parameter status must match ODBC definition." );
+
+static_assert( sizeof ( std::ptrdiff_t ) == sizeof ( SQLLEN ), "Bind offsets must match the size of SQLLEN." );
+
+static_assert( static_cast< SQLSMALLINT >( ParamDirection::Input ) == SQL_PARAM_INPUT, "Parameter direction must match ODBC definition." );
+static_assert( static_cast< SQLSMALLINT >( ParamDirection::InputOutput ) == SQL_PARAM_INPUT_OUTPUT, "Parameter direction must match ODBC definition." );
+static_assert( static_cast< SQLSMALLINT >( ParamDirection::Output ) == SQL_PARAM_OUTPUT, "Parameter direction must match ODBC definition." );
+
+static_assert( static_cast< SQLUSMALLINT >( ParamOperation::Proceed ) == SQL_PARAM_PROCEED, "Parameter operation must match ODBC definition." );
+static_assert( static_cast< SQLUSMALLINT >( ParamOperation::Ignore ) == SQL_PARAM_IGNORE, "Parameter operation must match ODBC definition." );
+
+static_assert( static_cast< SQLSMALLINT >( FetchOrientation::Next ) == SQL_FETCH_NEXT, "Fetch orientation must match ODBC definition." );
+static_assert( static_cast< SQLSMALLINT >( FetchOrientation::First ) == SQL_FETCH_FIRST, "Fetch orientation must match ODBC definition." );
+static_assert( static_cast< SQLSMALLINT >( FetchOrientation::Last ) == SQL_FETCH_LAST, "Fetch orientation must match ODBC definition." );
+static_assert( static_cast< SQLSMALLINT >( FetchOrientation::Prior ) == SQL_FETCH_PRIOR, "Fetch orientation must match ODBC definition." );
+static_assert( static_cast< SQLSMALLINT >( FetchOrientation::Absolute ) == SQL_FETCH_ABSOLUTE, "Fetch orientation must match ODBC definition." );
+static_assert( static_cast< SQLSMALLINT >( FetchOrientation::Relative ) == SQL_FETCH_RELATIVE, "Fetch orientation must match ODBC definition." );
+
+inline SQLULEN cursorType( const CursorType type )
+{
+    switch ( type )
+    {
+    case CursorType::Static:
+        return SQL_CURSOR_STATIC;
+    case CursorType::Keyset:
+        return SQL_CURSOR_KEYSET_DRIVEN;
+    case CursorType::Dynamic:
+        return SQL_CURSOR_DYNAMIC;
+    default:
+        return SQL_CURSOR_FORWARD_ONLY;
+    }
+}
+
+inline SQLULEN concurrency( const Concurrency concurrency )
+{
+    switch ( concurrency )
+    {
+    case Concurrency::Lock:
+        return SQL_CONCUR_LOCK;
+    case Concurrency::RowVersion:
+        return SQL_CONCUR_ROWVER;
+    case Concurrency::Values:
+        return SQL_CONCUR_VALUES;
+    default:
+        return SQL_CONCUR_READ_ONLY;
+    }
+}
+
+static_assert( static_cast< SQLUSMALLINT >( RowStatus::Success ) == SQL_ROW_SUCCESS, "Row status must match ODBC definition." );
+static_assert( static_cast< SQLUSMALLINT >( RowStatus::SuccessWithInfo ) == SQL_ROW_SUCCESS_WITH_INFO, "Row status must match ODBC definition." );
+static_assert( static_cast< SQLUSMALLINT >( RowStatus::Error ) == SQL_ROW_ERROR, "Row status must match ODBC definition." );
+static_assert( static_cast< SQLUSMALLINT >( RowStatus::NoRow ) == SQL_ROW_NOROW, "Row status must match ODBC definition." );
+static_assert( static_cast< SQLUSMALLINT >( RowStatus::Updated ) == SQL_ROW_UPDATED, "Row status must match ODBC definition." );
+static_assert( static_cast< SQLUSMALLINT >( RowStatus::Deleted ) == SQL_ROW_DELETED, "Row status must match ODBC definition." );
+static_assert( static_cast< SQLUSMALLINT >( RowStatus::Added ) == SQL_ROW_ADDED, "Row status must match ODBC definition." );
+
+template< typename Bindings >
+void pointRecords( const SQLHDESC desc, const Bindings& bindings, const char* const base )
+{
+    SQLSMALLINT record = 0;
+
+    for ( const auto& binding : bindings )
+    {
+        ++record;
+
+        // Deferred columns occupy a column number but are not bound.
+        if ( binding.cType == deferredType )
+        {
+            continue;
+        }
+
+        const auto indicator = binding.indicator >= 0 ? (SQLPOINTER) ( base + binding.indicator ) : nullptr;
+
+        // Setting the data pointer last makes the driver check the consistency of the complete record.
+        check( ::SQLSetDescField( desc, record, SQL_DESC_INDICATOR_PTR, indicator, 0 ), SQL_HANDLE_DESC, desc );
+        check( ::SQLSetDescField( desc, record, SQL_DESC_OCTET_LENGTH_PTR, indicator, 0 ), SQL_HANDLE_DESC, desc );
+        check( ::SQLSetDescField( desc, record, SQL_DESC_DATA_PTR, (SQLPOINTER) ( base + binding.data ), 0 ), SQL_HANDLE_DESC, desc );
+    }
+}
+
+}
+
+struct Statement::PutData
+{
+    const LongParam* param{ nullptr }; ///< the parameter whose source is read, null while the next one is requested
+    char chunk[ chunkSize ];
+    SQLLEN size{ -1 }; ///< the number of bytes in the chunk which were not yet sent, negative if the source has to be read
+    bool empty{ true }; ///< whether the source of the current parameter yielded no data yet
+};
+
+bool BindingPlan::empty() const
+{
+    return params_.empty() && cols_.empty();
+}
+
+bool BindingPlan::hasDeferredCols() const
+{
+    return std::any_of( cols_.begin(), cols_.end(), []( const Binding& binding ) { return binding.cType == deferredType; } );
+}
+
+BindingRecorder::BindingRecorder( BindingPlan& plan, const void* const base, const std::size_t size )
+: plan_( plan )
+, base_{ static_cast< const char* >( base ) }
+, size_{ size }
+{
+}
+
+std::ptrdiff_t BindingRecorder::offset( const void* const data, const std::size_t size ) const
+{
+    const std::less_equal< const char* > lessEqual;
+    const auto* const begin = static_cast< const char* >( data );
+
+    if ( !lessEqual( base_, begin ) || !lessEqual( begin + size, base_ + size_ ) )
+    {
+        throw std::invalid_argument{ "Bound value is not part of the recorded row." };
+    }
+
+    return begin - base_;
+}
+
+BindingRecorder& BindingRecorder::doBindDeferredCol( DeferredBase& col )
+{
+    plan_.cols_.push_back( {
+        offset( &col, sizeof ( col ) ),
+        -1,
+        deferredType, 0, 0, 0,
+        ParamDirection::Input
+    } );
+
+    return *this;
+}
+
+BindingRecorder& BindingRecorder::doBindParam( const void* const data, const short cType, const short sqlType, const std::size_t size, const std::size_t length, const long* const indicator )
+{
+    plan_.params_.push_back( {
+        offset( data, size ),
+        indicator ? offset( indicator, sizeof ( *indicator ) ) : -1,
+        cType, sqlType, size, length,
+        direction_
+    } );
+
+    return *this;
+}
+
+BindingRecorder& BindingRecorder::doBindCol( void* const data, const short cType, const std::size_t size, long* const indicator )
+{
+    plan_.cols_.push_back( {
+        offset( data, size ),
+        indicator ? offset( indicator, sizeof ( *indicator ) ) : -1,
+        cType, 0, size, 0,
+        ParamDirection::Input
+    } );
+
+    return *this;
+}
+
+SharedDescriptor::SharedDescriptor( Connection& conn, const BindingPlan& plan )
+: plan_{ plan }
+, base_{ nullptr }
+{
+    check( ::SQLAllocHandle( SQL_HANDLE_DESC, conn.dbc_, &desc_ ), SQL_HANDLE_DBC, conn.dbc_ );
+
+    try
+    {
+        // The records are left unbound until the descriptor is first pointed to a row.
+        SQLSMALLINT col = 0;
+
+        for ( const auto& binding : plan.cols_ )
+        {
+            const auto timestamp = binding.cType == SQL_C_TIMESTAMP || binding.cType == SQL_C_TYPE_TIMESTAMP;
+
+            check( ::SQLSetDescRec(
+                desc_,
+                ++col,
+                timestamp ? SQL_DATETIME : binding.cType,
+                timestamp ? SQL_CODE_TIMESTAMP : 0,
+                binding.size,
+                0,
+                0,
+                nullptr,
+                nullptr,
+                nullptr
+            ), SQL_HANDLE_DESC, desc_ );
+        }
+    }
+    catch ( ... )
+    {
+        ::SQLFreeHandle( SQL_HANDLE_DESC, desc_ );
+
+        throw;
+    }
+}
+
+SharedDescriptor::~SharedDescriptor()
+{
+    ::SQLFreeHandle( SQL_HANDLE_DESC, desc_ );
+}
+
+void SharedDescriptor::point( void* const base )
+{
+    if ( base_ != base )
+    {
+        pointRecords( desc_, plan_.cols_, static_cast< const char* >( base ) );
+
+        base_ = base;
+    }
+}
+
+struct CancelHandle::Token
+{
+    std::mutex mutex;
+    SQLHSTMT stmt; ///< reset before the statement releases its handle
+};
+
+CancelHandle::CancelHandle( std::shared_ptr< Token > token )
+: token_{ std::move( token ) }
+{
+}
+
+void CancelHandle::cancel() const
+{
+    // Holding the lock keeps the statement from recycling its handle while it is being cancelled.
+    std::lock_guard< std::mutex > lock{ token_->mutex };
+
+    if ( token_->stmt )
+    {
+        check( ::SQLCancel( token_->stmt ), SQL_HANDLE_STMT, token_->stmt );
+    }
 }
 
-Statement::Statement( Connection& conn, const char* const stmt )
+Statement::Statement( Connection& conn, const char* const stmt, const CursorType cursorType, const Concurrency concurrency )
 : param_{ 0 }
 , col_{ 0 }
+, fetches_{ 0 }
 , pos_{ false }
+, async_{ false }
+, executing_{ false }
+, queryTimeout_{ 0 }
+, appliedTimeout_{ 0 }
+, deadline_{ std::chrono::steady_clock::time_point::max() }
+, handles_{ conn.handles_ }
+, prepared_{ !conn.lazyPrepare_ }
+, recyclable_{ true }
+, bindValidation_{ conn.bindValidation_ }
 {
-   check( ::SQLAllocHandle( SQL_HANDLE_STMT, conn.dbc_, &stmt_ ), SQL_HANDLE_DBC, conn.dbc_ );
+   stmt_ = conn.handles_->acquire();
+
+   if ( bindValidation_ != BindValidation::Off )
+   {
+       text_ = stmt;
+   }
+
+   if ( cursorType != CursorType::ForwardOnly )
+   {
+       setAttr( SQL_ATTR_CURSOR_TYPE, (SQLPOINTER) rodbc::cursorType( cursorType ) );
+   }
+
+   if ( concurrency != Concurrency::ReadOnly )
+   {
+       setAttr( SQL_ATTR_CONCURRENCY, (SQLPOINTER) rodbc::concurrency( concurrency ) );
+   }
+
+   if ( !prepared_ )
+   {
+       sql_ = stmt;
+
+       ++conn.handles_->prepareStatistics.deferred;
+
+       return;
+   }
+
    check( ::SQLPrepare( stmt_, (SQLCHAR*) stmt, SQL_NTS ), SQL_HANDLE_STMT, stmt_ );
 }
 
 Statement::~Statement()
 {
+    detachDeferred();
+
+    const auto handles = handles_.lock();
+
+    if ( handles && !prepared_ )
+    {
+        ++handles->prepareStatistics.discarded;
+    }
+
+    if ( cancel_ )
+    {
+        std::lock_guard< std::mutex > lock{ cancel_->mutex };
+
+        cancel_->stmt = nullptr;
+    }
+
     if ( stmt_ )
     {
-        ::SQLFreeHandle( SQL_HANDLE_STMT, stmt_ );
+        if ( handles && recyclable_ && !executing_ )
+        {
+            handles->recycle( stmt_ );
+        }
+        else
+        {
+            ::SQLFreeHandle( SQL_HANDLE_STMT, stmt_ );
+        }
 
         stmt_ = nullptr;
     }
@@ -97,32 +585,100 @@ Statement::~Statement()
 Statement::Statement( Statement&& that ) noexcept
 : param_{ that.param_ }
 , col_{ that.col_ }
+, fetches_{ that.fetches_ }
 , pos_{ that.pos_ }
+, async_{ that.async_ }
+, executing_{ that.executing_ }
+, queryTimeout_{ that.queryTimeout_ }
+, appliedTimeout_{ that.appliedTimeout_ }
+, deadline_{ that.deadline_ }
+, handles_{ std::move( that.handles_ ) }
+, prepared_{ that.prepared_ }
+, sql_{ std::move( that.sql_ ) }
+, recyclable_{ that.recyclable_ }
+, bindValidation_{ that.bindValidation_ }
+, text_{ std::move( that.text_ ) }
+, deferred_{ std::move( that.deferred_ ) }
+, putData_{ std::move( that.putData_ ) }
+, cancel_{ std::move( that.cancel_ ) }
 {
+    direction_ = that.direction_;
+
     stmt_ = that.stmt_;
     that.stmt_ = nullptr;
+
+    that.prepared_ = true;
+
+    attachDeferred();
 }
 
 Statement& Statement::operator= ( Statement&& that ) noexcept
 {
+    // Cancel handles follow the statement handle they were created for.
     std::swap( stmt_, that.stmt_ );
+    std::swap( cancel_, that.cancel_ );
+    std::swap( sql_, that.sql_ );
+    std::swap( handles_, that.handles_ );
+    std::swap( prepared_, that.prepared_ );
 
     param_ = that.param_;
     col_ = that.col_;
+    fetches_ = that.fetches_;
+    direction_ = that.direction_;
     pos_ = that.pos_;
+    async_ = that.async_;
+    executing_ = that.executing_;
+    queryTimeout_ = that.queryTimeout_;
+    appliedTimeout_ = that.appliedTimeout_;
+    deadline_ = that.deadline_;
+    std::swap( recyclable_, that.recyclable_ );
+    bindValidation_ = that.bindValidation_;
+    std::swap( text_, that.text_ );
+
+    std::swap( deferred_, that.deferred_ );
+    attachDeferred();
+    that.attachDeferred();
+
+    std::swap( putData_, that.putData_ );
 
     return *this;
 }
 
 #define DEF_BIND_PARAM( type ) \
-Statement& Statement::bindParam( const type& param ) \
+template< typename Derived > \
+Derived& Binder< Derived >::bindParam( const type& param ) \
 { \
     return doBindParam( &param ); \
 } \
 \
-Statement& Statement::bindParam( const Nullable< type >& param ) \
+template< typename Derived > \
+Derived& Binder< Derived >::bindParam( const Nullable< type >& param ) \
 { \
     return doBindParam( &param.val_, &param.ind_ ); \
+} \
+\
+template< typename Derived > \
+Derived& Binder< Derived >::bindOutParam( type& param, const ParamDirection direction ) \
+{ \
+    return doBindOutParam( direction, [ this, &param ]() { doBindParam( &param ); } ); \
+} \
+\
+template< typename Derived > \
+Derived& Binder< Derived >::bindOutParam( Nullable< type >& param, const ParamDirection direction ) \
+{ \
+    return doBindOutParam( direction, [ this, &param ]() { doBindParam( &param.val_, &param.ind_ ); } ); \
+} \
+\
+template< typename Derived > \
+Derived& Binder< Derived >::bindParam( const ColumnArray< type >& param ) \
+{ \
+    return doBindParam( param.data() ); \
+} \
+\
+template< typename Derived > \
+Derived& Binder< Derived >::bindParam( const ColumnArray< Nullable< type > >& param ) \
+{ \
+    return doBindParam( param.data(), param.indicators() ); \
 }
 
 DEF_BIND_PARAM( std::int8_t )
@@ -144,6 +700,73 @@ DEF_BIND_PARAM( Timestamp )
 
 #undef DEF_BIND_PARAM
 
+template< typename Derived >
+Derived& Binder< Derived >::bindParam( const LongParam& param )
+{
+    return derived().doBindParam(
+        &param,
+        param.binary_ ? SQL_C_BINARY : SQL_C_CHAR,
+        param.binary_ ? SQL_LONGVARBINARY : SQL_LONGVARCHAR,
+        0,
+        0,
+        &param.ind_
+    );
+}
+
+void Statement::bindParams( const BindingPlan& plan, const void* const base )
+{
+    rebindParams();
+
+    const auto* const data = static_cast< const char* >( base );
+
+    for ( const auto& binding : plan.params_ )
+    {
+        direction_ = binding.direction;
+
+        try
+        {
+            doBindParam(
+                data + binding.data, binding.cType, binding.sqlType, binding.size, binding.length,
+                binding.indicator >= 0 ? reinterpret_cast< const long* >( data + binding.indicator ) : nullptr
+            );
+        }
+        catch ( ... )
+        {
+            direction_ = ParamDirection::Input;
+
+            throw;
+        }
+    }
+
+    direction_ = ParamDirection::Input;
+}
+
+void Statement::pointParams( const BindingPlan& plan, const void* const base )
+{
+    doPointBindings( SQL_ATTR_APP_PARAM_DESC, plan.params_, static_cast< const char* >( base ) );
+}
+
+void Statement::bindParamOffset( const std::ptrdiff_t& offset )
+{
+    setAttr( SQL_ATTR_PARAM_BIND_OFFSET_PTR, (SQLPOINTER) &offset );
+}
+
+void Statement::bindParamArrayByColumn( const std::size_t count )
+{
+    doBindParamArray( SQL_PARAM_BIND_BY_COLUMN, count );
+}
+
+void Statement::bindParamStatus( ParamStatus* const status, long& paramsProcessed )
+{
+    setAttr( SQL_ATTR_PARAM_STATUS_PTR, status );
+    setAttr( SQL_ATTR_PARAMS_PROCESSED_PTR, &paramsProcessed );
+}
+
+void Statement::bindParamOperations( const ParamOperation* const operations )
+{
+    setAttr( SQL_ATTR_PARAM_OPERATION_PTR, (SQLPOINTER) operations );
+}
+
 Statement& Statement::rebindParams()
 {
     param_ = 0;
@@ -152,14 +775,28 @@ Statement& Statement::rebindParams()
 }
 
 #define DEF_BIND_COL( type ) \
-Statement& Statement::bindCol( type& col ) \
+template< typename Derived > \
+Derived& Binder< Derived >::bindCol( type& col ) \
 { \
     return doBindCol( &col ); \
 } \
 \
-Statement& Statement::bindCol( Nullable< type >& col ) \
+template< typename Derived > \
+Derived& Binder< Derived >::bindCol( Nullable< type >& col ) \
 { \
     return doBindCol( &col.val_, &col.ind_ ); \
+} \
+\
+template< typename Derived > \
+Derived& Binder< Derived >::bindCol( ColumnArray< type >& col ) \
+{ \
+    return doBindCol( col.data() ); \
+} \
+\
+template< typename Derived > \
+Derived& Binder< Derived >::bindCol( ColumnArray< Nullable< type > >& col ) \
+{ \
+    return doBindCol( col.data(), col.indicators() ); \
 }
 
 DEF_BIND_COL( std::int8_t )
@@ -181,90 +818,835 @@ DEF_BIND_COL( Timestamp )
 
 #undef DEF_BIND_COL
 
-Statement& Statement::rebindCols()
+void Statement::bindColOffset( const std::ptrdiff_t& offset )
 {
-    col_ = 0;
+    setAttr( SQL_ATTR_ROW_BIND_OFFSET_PTR, (SQLPOINTER) &offset );
+}
 
-    return *this;
+void Statement::bindColArrayByColumn( const std::size_t count, long& rowsFetched )
+{
+    doBindColArray( SQL_BIND_BY_COLUMN, count, &rowsFetched );
 }
 
-void Statement::exec()
+void Statement::bindColArrayByRow( const std::size_t rowSize, const std::size_t count, long& rowsFetched )
+{
+    doBindColArray( rowSize, count, &rowsFetched );
+}
+
+void Statement::bindRowStatus( RowStatus* const status )
+{
+    setAttr( SQL_ATTR_ROW_STATUS_PTR, status );
+}
+
+std::vector< ColumnDescription > Statement::describeCols()
 {
-    if ( pos_ )
+    prepare();
+
+    SQLSMALLINT count;
+    check( ::SQLNumResultCols( stmt_, &count ), SQL_HANDLE_STMT, stmt_ );
+
+    std::vector< ColumnDescription > cols( count );
+
+    for ( SQLUSMALLINT col = 0; col < count; ++col )
     {
-        check( ::SQLFreeStmt( stmt_, SQL_CLOSE ), SQL_HANDLE_STMT, stmt_ );
+        auto& description = cols[ col ];
 
-        pos_ = false;
+        SQLCHAR name[ 256 ];
+        SQLSMALLINT nameLength;
+        SQLULEN size;
+        SQLSMALLINT nullable;
+
+        check( ::SQLDescribeCol( stmt_, col + 1, name, sizeof ( name ), &nameLength, &description.type, &size, &description.digits, &nullable ), SQL_HANDLE_STMT, stmt_ );
+
+        description.name.assign( (const char*) name, std::min< std::size_t >( nameLength, sizeof ( name ) - 1 ) );
+        description.size = size;
+        description.nullable = nullable != SQL_NO_NULLS;
     }
 
-    check( ::SQLExecute( stmt_ ), SQL_HANDLE_STMT, stmt_ );
+    return cols;
 }
 
-bool Statement::fetch()
+template< typename Derived >
+Derived& Binder< Derived >::bindCol( void* const data, const short cType, const std::size_t size, long* const indicator )
+{
+    return derived().doBindCol( data, cType, size, indicator );
+}
+
+void Statement::bindCols( const BindingPlan& plan, void* const base )
 {
-    const bool result = check( ::SQLFetch( stmt_ ), SQL_HANDLE_STMT, stmt_ ) != SQL_NO_DATA;
+    rebindCols();
 
-    pos_ = true;
+    auto* const data = static_cast< char* >( base );
 
-    return result;
+    for ( const auto& binding : plan.cols_ )
+    {
+        if ( binding.cType == deferredType )
+        {
+            doBindDeferredCol( *reinterpret_cast< DeferredBase* >( data + binding.data ) );
+
+            continue;
+        }
+
+        doBindCol(
+            data + binding.data, binding.cType, binding.size,
+            binding.indicator >= 0 ? reinterpret_cast< long* >( data + binding.indicator ) : nullptr
+        );
+    }
 }
 
-Statement& Statement::doBindStringParam( const char* const data, const std::size_t length , const long* const indicator )
+void Statement::pointCols( const BindingPlan& plan, void* const base )
 {
-    return doBindParam( data, SQL_C_CHAR, SQL_VARCHAR, sizeof ( char ), length, indicator );
+    doPointBindings( SQL_ATTR_APP_ROW_DESC, plan.cols_, static_cast< const char* >( base ) );
 }
 
-Statement& Statement::doBindStringCol( char* const data, const std::size_t length, long* const indicator )
+void Statement::bindCols( const SharedDescriptor& desc )
 {
-    return doBindCol( data, SQL_C_CHAR, sizeof ( char ) * ( length + 1 ), indicator );
+    setAttr( SQL_ATTR_APP_ROW_DESC, desc.desc_ );
+
+    col_ = 0;
+
+    for ( const auto& binding : desc.plan_.cols_ )
+    {
+        ++col_;
+
+        if ( bindValidation_ != BindValidation::Off )
+        {
+            validateCol( binding.cType, binding.size );
+        }
+    }
 }
 
-Statement& Statement::doBindNumberParam( const char* const data, const std::size_t length , const long* const indicator )
+void Statement::resetRowDescriptor()
 {
-    return doBindParam( data, SQL_C_CHAR, SQL_NUMERIC, sizeof ( char ), length, indicator );
+    setAttr( SQL_ATTR_APP_ROW_DESC, SQL_NULL_HDESC );
 }
 
-Statement& Statement::doBindNumberCol( char* const data, const std::size_t length, long* const indicator )
+Statement& Statement::rebindCols()
 {
-    return doBindCol( data, SQL_C_CHAR, sizeof ( char ) * ( length + 1 ), indicator );
+    col_ = 0;
+
+    detachDeferred();
+
+    return *this;
 }
 
-void Statement::doBindParamArray( const std::size_t size, const std::size_t count )
+void Statement::setQueryTimeout( const std::chrono::seconds timeout )
 {
-    check( ::SQLSetStmtAttr( stmt_, SQL_ATTR_PARAM_BIND_TYPE, (SQLPOINTER) size, 0 ), SQL_HANDLE_STMT, stmt_ );
-    check( ::SQLSetStmtAttr( stmt_, SQL_ATTR_PARAMSET_SIZE, (SQLPOINTER) count, 0 ), SQL_HANDLE_STMT, stmt_ );
+    queryTimeout_ = timeout.count();
 }
 
-void Statement::doBindColArray( const std::size_t size, const std::size_t count, long* const rowsFetched )
+void Statement::setDeadline( const std::chrono::steady_clock::time_point deadline )
 {
-    check( ::SQLSetStmtAttr( stmt_, SQL_ATTR_ROW_BIND_TYPE, (SQLPOINTER) size, 0 ), SQL_HANDLE_STMT, stmt_ );
-    check( ::SQLSetStmtAttr( stmt_, SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER) count, 0 ), SQL_HANDLE_STMT, stmt_ );
-    check( ::SQLSetStmtAttr( stmt_, SQL_ATTR_ROWS_FETCHED_PTR, rowsFetched, 0 ), SQL_HANDLE_STMT, stmt_ );
+    deadline_ = deadline;
 }
 
-template< typename Param >
-Statement& Statement::doBindParam( const Param* const data, const long* const indicator )
+CancelHandle Statement::cancelHandle() const
 {
-    using ParamTraits = OdbcTraits< Param >;
+    if ( !cancel_ )
+    {
+        cancel_ = std::make_shared< CancelHandle::Token >();
+        cancel_->stmt = stmt_;
+    }
 
-    return doBindParam( data, ParamTraits::CType, ParamTraits::SqlType, sizeof ( Param ), 0, indicator );
+    return CancelHandle{ cancel_ };
 }
 
-template< typename Col >
-Statement& Statement::doBindCol( Col* const data, long* const indicator )
+Statement& Statement::unbindCols()
 {
-    using ColTraits = OdbcTraits< Col >;
+    check( ::SQLFreeStmt( stmt_, SQL_UNBIND ), SQL_HANDLE_STMT, stmt_ );
 
-    return doBindCol( data, ColTraits::CType, sizeof ( Col ), indicator );
+    col_ = 0;
 
+    return *this;
 }
 
-Statement& Statement::doBindParam( const void* const data, const short cType, const short sqlType, const std::size_t size, const std::size_t length, const long* const indicator )
+void Statement::exec()
 {
-    check( ::SQLBindParameter(
+    SQLRETURN rc;
+    bool expired;
+
+    waitUntil( [ & ]()
+    {
+        return doExec( rc, expired );
+    } );
+
+    if ( expired )
+    {
+        throw Exception{ "HYT00", deadlineExpired };
+    }
+
+    check( rc, SQL_HANDLE_STMT, stmt_ );
+}
+
+bool Statement::fetch()
+{
+    SQLRETURN rc;
+
+    waitUntil( [ & ]()
+    {
+        return doFetch( rc );
+    } );
+
+    return check( rc, SQL_HANDLE_STMT, stmt_ ) != SQL_NO_DATA;
+}
+
+bool Statement::fetchScroll( const FetchOrientation orientation, const long offset )
+{
+    SQLRETURN rc;
+
+    waitUntil( [ & ]()
+    {
+        return doFetch( rc, orientation, offset );
+    } );
+
+    return check( rc, SQL_HANDLE_STMT, stmt_ ) != SQL_NO_DATA;
+}
+
+bool Statement::moreResults()
+{
+    const bool result = check( ::SQLMoreResults( stmt_ ), SQL_HANDLE_STMT, stmt_ ) != SQL_NO_DATA;
+
+    pos_ = result;
+
+    return result;
+}
+
+void Statement::bulkAdd()
+{
+    check( ::SQLBulkOperations( stmt_, SQL_ADD ), SQL_HANDLE_STMT, stmt_ );
+}
+
+void Statement::closeCursor()
+{
+    check( ::SQLFreeStmt( stmt_, SQL_CLOSE ), SQL_HANDLE_STMT, stmt_ );
+
+    pos_ = false;
+}
+
+long Statement::rowCount() const
+{
+    SQLLEN rowCount = -1;
+
+    check( ::SQLRowCount( stmt_, &rowCount ), SQL_HANDLE_STMT, stmt_ );
+
+    return rowCount;
+}
+
+bool Statement::pollExec()
+{
+    enableAsync();
+
+    SQLRETURN rc;
+    bool expired;
+
+    if ( !doExec( rc, expired ) )
+    {
+        return false;
+    }
+
+    if ( expired )
+    {
+        throw Exception{ "HYT00", deadlineExpired };
+    }
+
+    check( rc, SQL_HANDLE_STMT, stmt_ );
+
+    return true;
+}
+
+bool Statement::pollFetch( bool& result )
+{
+    enableAsync();
+
+    SQLRETURN rc;
+
+    if ( !doFetch( rc ) )
+    {
+        return false;
+    }
+
+    result = check( rc, SQL_HANDLE_STMT, stmt_ ) != SQL_NO_DATA;
+
+    return true;
+}
+
+Status Statement::tryExec()
+{
+    SQLRETURN rc;
+    bool expired;
+
+    waitUntil( [ & ]()
+    {
+        return doExec( rc, expired );
+    } );
+
+    if ( expired )
+    {
+        return Status{ "HYT00", deadlineExpired };
+    }
+
+    return failed( rc ) ? Status{ SQL_HANDLE_STMT, stmt_ } : Status{};
+}
+
+Status Statement::tryFetch( bool& result )
+{
+    SQLRETURN rc;
+
+    waitUntil( [ & ]()
+    {
+        return doFetch( rc );
+    } );
+
+    result = rc != SQL_NO_DATA && !failed( rc );
+
+    return failed( rc ) ? Status{ SQL_HANDLE_STMT, stmt_ } : Status{};
+}
+
+bool Statement::getData( const unsigned short col, const Sink& sink, const bool binary )
+{
+    char chunk[ chunkSize ];
+    const SQLLEN capacity = binary ? sizeof ( chunk ) : sizeof ( chunk ) - 1;
+
+    for ( ;; )
+    {
+        SQLLEN ind;
+        const auto rc = check( ::SQLGetData( stmt_, col, binary ? SQL_C_BINARY : SQL_C_CHAR, chunk, sizeof ( chunk ), &ind ), SQL_HANDLE_STMT, stmt_ );
+
+        if ( rc == SQL_NO_DATA )
+        {
+            return true;
+        }
+
+        if ( ind == SQL_NULL_DATA )
+        {
+            return false;
+        }
+
+        sink( chunk, ind == SQL_NO_TOTAL || ind > capacity ? capacity : ind );
+
+        if ( rc == SQL_SUCCESS )
+        {
+            return true;
+        }
+    }
+}
+
+bool Statement::getData( const unsigned short col, std::ostream& stream, const bool binary )
+{
+    return getData( col, [ &stream ]( const char* const data, const std::size_t size )
+    {
+        stream.write( data, size );
+    }, binary );
+}
+
+bool Statement::getData( const unsigned short col, const int fd, const bool binary )
+{
+    return getData( col, [ fd ]( const char* data, std::size_t size )
+    {
+        while ( size != 0 )
+        {
+            const auto written = ::write( fd, data, size );
+
+            if ( written < 0 )
+            {
+                if ( errno == EINTR )
+                {
+                    continue;
+                }
+
+                throw std::system_error{ errno, std::system_category() };
+            }
+
+            data += written;
+            size -= written;
+        }
+    }, binary );
+}
+
+void Statement::enableAsync()
+{
+    if ( async_ )
+    {
+        return;
+    }
+
+    async_ = true;
+    recyclable_ = false;
+
+    // Drivers without support for asynchronous execution keep executing synchronously.
+    ::SQLSetStmtAttr( stmt_, SQL_ATTR_ASYNC_ENABLE, (SQLPOINTER) SQL_ASYNC_ENABLE_ON, 0 );
+}
+
+bool Statement::doExec( short& rc, bool& expired )
+{
+    expired = false;
+
+    if ( !executing_ )
+    {
+        if ( failed( rc = doPrepare() ) || failed( rc = applyTimeout( expired ) ) )
+        {
+            return true;
+        }
+
+        if ( pos_ )
+        {
+            if ( failed( rc = ::SQLFreeStmt( stmt_, SQL_CLOSE ) ) )
+            {
+                return true;
+            }
+
+            pos_ = false;
+        }
+    }
+
+    if ( !putData_ )
+    {
+        rc = ::SQLExecute( stmt_ );
+
+        executing_ = rc == SQL_STILL_EXECUTING;
+
+        if ( executing_ || rc != SQL_NEED_DATA )
+        {
+            return !executing_;
+        }
+
+        putData_.reset( new PutData{} );
+    }
+
+    executing_ = !doPutData( rc );
+
+    return !executing_;
+}
+
+bool Statement::doFetch( short& rc, const FetchOrientation orientation, const long offset )
+{
+    if ( orientation == FetchOrientation::Next )
+    {
+        rc = ::SQLFetch( stmt_ );
+    }
+    else
+    {
+        rc = ::SQLFetchScroll( stmt_, static_cast< SQLSMALLINT >( orientation ), offset );
+    }
+
+    if ( rc == SQL_STILL_EXECUTING )
+    {
+        return false;
+    }
+
+    pos_ = true;
+    ++fetches_;
+
+    return true;
+}
+
+void Statement::prepare()
+{
+    check( doPrepare(), SQL_HANDLE_STMT, stmt_ );
+}
+
+short Statement::doPrepare()
+{
+    if ( prepared_ )
+    {
+        return SQL_SUCCESS;
+    }
+
+    const auto rc = ::SQLPrepare( stmt_, (SQLCHAR*) sql_.c_str(), SQL_NTS );
+
+    if ( failed( rc ) )
+    {
+        return rc;
+    }
+
+    prepared_ = true;
+
+    sql_.clear();
+    sql_.shrink_to_fit();
+
+    if ( const auto handles = handles_.lock() )
+    {
+        ++handles->prepareStatistics.prepared;
+    }
+
+    return rc;
+}
+
+short Statement::applyTimeout( bool& expired )
+{
+    using Clock = std::chrono::steady_clock;
+
+    auto timeout = queryTimeout_;
+
+    auto deadline = deadline_;
+
+    if ( const auto handles = handles_.lock() )
+    {
+        deadline = std::min( deadline, handles->deadline );
+    }
+
+    if ( deadline != Clock::time_point::max() )
+    {
+        const auto now = Clock::now();
+
+        if ( deadline <= now )
+        {
+            expired = true;
+
+            return SQL_ERROR;
+        }
+
+        const auto remaining = std::chrono::duration_cast< std::chrono::seconds >( deadline - now + std::chrono::seconds{ 1 } - Clock::duration{ 1 } ).count();
+
+        if ( timeout == 0 || timeout > static_cast< unsigned long >( remaining ) )
+        {
+            timeout = remaining;
+        }
+    }
+
+    if ( appliedTimeout_ != timeout )
+    {
+        recyclable_ = false;
+
+        const auto rc = ::SQLSetStmtAttr( stmt_, SQL_ATTR_QUERY_TIMEOUT, (SQLPOINTER) timeout, 0 );
+
+        if ( failed( rc ) )
+        {
+            return rc;
+        }
+
+        appliedTimeout_ = timeout;
+    }
+
+    return SQL_SUCCESS;
+}
+
+bool Statement::doPutData( short& rc )
+{
+    // In asynchronous mode, both functions have to be called again with the same arguments while they are still executing.
+    auto& state = *putData_;
+
+    try
+    {
+        for ( ;; )
+        {
+            if ( !state.param )
+            {
+                SQLPOINTER token;
+
+                if ( ( rc = ::SQLParamData( stmt_, &token ) ) == SQL_STILL_EXECUTING )
+                {
+                    return false;
+                }
+
+                if ( rc != SQL_NEED_DATA )
+                {
+                    break;
+                }
+
+                state.param = static_cast< const LongParam* >( token );
+                state.empty = true;
+            }
+
+            if ( state.size < 0 )
+            {
+                state.size = static_cast< SQLLEN >( state.param->source_( state.chunk, sizeof ( state.chunk ) ) );
+
+                // An empty value is still sent as a single chunk of zero bytes.
+                if ( state.size == 0 && !state.empty )
+                {
+                    state.param = nullptr;
+                    state.size = -1;
+
+                    continue;
+                }
+            }
+
+            if ( ( rc = ::SQLPutData( stmt_, state.chunk, state.size ) ) == SQL_STILL_EXECUTING )
+            {
+                return false;
+            }
+
+            if ( failed( rc ) )
+            {
+                break;
+            }
+
+            if ( state.size == 0 )
+            {
+                state.param = nullptr;
+            }
+
+            state.size = -1;
+            state.empty = false;
+        }
+    }
+    catch ( ... )
+    {
+        // Only the source can throw, hence the driver is still waiting for data.
+        ::SQLCancel( stmt_ );
+
+        putData_.reset();
+        executing_ = false;
+
+        throw;
+    }
+
+    putData_.reset();
+
+    return true;
+}
+
+template< typename Derived >
+Derived& Binder< Derived >::doBindStringParam( const char* const data, const std::size_t length , const long* const indicator )
+{
+    return derived().doBindParam( data, SQL_C_CHAR, SQL_VARCHAR, sizeof ( char ) * ( length + 1 ), length, indicator );
+}
+
+template< typename Derived >
+Derived& Binder< Derived >::doBindStringCol( char* const data, const std::size_t length, long* const indicator )
+{
+    return derived().doBindCol( data, SQL_C_CHAR, sizeof ( char ) * ( length + 1 ), indicator );
+}
+
+template< typename Derived >
+Derived& Binder< Derived >::doBindNumberParam( const char* const data, const std::size_t length , const long* const indicator )
+{
+    return derived().doBindParam( data, SQL_C_CHAR, SQL_NUMERIC, sizeof ( char ) * ( length + 1 ), length, indicator );
+}
+
+template< typename Derived >
+Derived& Binder< Derived >::doBindNumberCol( char* const data, const std::size_t length, long* const indicator )
+{
+    return derived().doBindCol( data, SQL_C_CHAR, sizeof ( char ) * ( length + 1 ), indicator );
+}
+
+template< typename Derived >
+Derived& Binder< Derived >::doBindBinaryParam( const char* const data, const std::size_t length, const long* const indicator )
+{
+    return derived().doBindParam( data, SQL_C_BINARY, SQL_VARBINARY, sizeof ( char ) * length, length, indicator );
+}
+
+template< typename Derived >
+Derived& Binder< Derived >::doBindBinaryCol( char* const data, const std::size_t length, long* const indicator )
+{
+    return derived().doBindCol( data, SQL_C_BINARY, sizeof ( char ) * length, indicator );
+}
+
+void Statement::setAttr( const int attribute, void* const value )
+{
+    // Resetting a handle does not restore its attributes, hence it can not be recycled afterwards.
+    recyclable_ = false;
+
+    check( ::SQLSetStmtAttr( stmt_, attribute, value, 0 ), SQL_HANDLE_STMT, stmt_ );
+}
+
+void Statement::validateParam( const short sqlType, const std::size_t length )
+{
+    const auto handles = handles_.lock();
+
+    if ( !handles || !describesParams( handles->dbms() ) )
+    {
+        return;
+    }
+
+    prepare();
+
+    SQLSMALLINT type;
+    SQLULEN size;
+    SQLSMALLINT digits;
+    SQLSMALLINT nullable;
+
+    // Drivers which can not describe parameters are not validated.
+    if ( failed( ::SQLDescribeParam( stmt_, param_, &type, &size, &digits, &nullable ) ) )
+    {
+        return;
+    }
+
+    const auto lossy =
+        ( direction_ != ParamDirection::Output && isLossy( sqlType, length, type, size ) ) ||
+        ( direction_ != ParamDirection::Input && isLossy( type, size, sqlType, length ) );
+
+    if ( lossy || isConverted( sqlType, type ) )
+    {
+        reportMismatch( true, param_, sqlType, type, lossy );
+    }
+}
+
+void Statement::validateCol( const short cType, const std::size_t size )
+{
+    prepare();
+
+    SQLCHAR name[ 1 ];
+    SQLSMALLINT nameLength;
+    SQLSMALLINT type;
+    SQLULEN colSize;
+    SQLSMALLINT digits;
+    SQLSMALLINT nullable;
+
+    if ( failed( ::SQLDescribeCol( stmt_, col_, name, sizeof ( name ), &nameLength, &type, &colSize, &digits, &nullable ) ) )
+    {
+        return;
+    }
+
+    const auto sqlType = sqlTypeOf( cType );
+    const auto capacity = cType == SQL_C_CHAR ? size - 1 : size;
+
+    // Converting result columns does not affect the execution plan, hence only lossy conversions are reported.
+    if ( isLossy( type, colSize, sqlType, capacity ) )
+    {
+        reportMismatch( false, col_, sqlType, type, true );
+    }
+}
+
+void Statement::reportMismatch( const bool param, const unsigned short number, const short boundType, const short describedType, const bool lossy )
+{
+    if ( bindValidation_ == BindValidation::Reject )
+    {
+        throw Exception{ "07006", std::string{ param ? "Parameter " : "Column " } + std::to_string( number ) + " is bound as SQL type " + std::to_string( boundType ) + " but described as SQL type " + std::to_string( describedType ) + " in \"" + text_ + "\"." };
+    }
+
+    const auto handles = handles_.lock();
+
+    if ( !handles )
+    {
+        return;
+    }
+
+    auto& mismatches = handles->bindMismatches;
+
+    // Rebinding the same statement text would otherwise report the same position again.
+    const auto reported = std::any_of( mismatches.begin(), mismatches.end(), [ & ]( const BindMismatch& mismatch )
+    {
+        return mismatch.param == param && mismatch.number == number && mismatch.stmt == text_;
+    } );
+
+    if ( !reported )
+    {
+        mismatches.push_back( { text_, param, number, boundType, describedType, lossy } );
+    }
+}
+
+Statement& Statement::doBindDeferredCol( DeferredBase& col )
+{
+    if ( col.stmt_ != this )
+    {
+        if ( col.stmt_ )
+        {
+            col.stmt_->releaseDeferred( col );
+        }
+
+        deferred_.push_back( &col );
+    }
+
+    col.stmt_ = this;
+    col.col_ = ++col_;
+    col.fetch_ = 0;
+
+    return *this;
+}
+
+void Statement::attachDeferred()
+{
+    for ( const auto col : deferred_ )
+    {
+        col->stmt_ = this;
+    }
+}
+
+void Statement::detachDeferred()
+{
+    for ( const auto col : deferred_ )
+    {
+        col->stmt_ = nullptr;
+    }
+
+    deferred_.clear();
+}
+
+void Statement::releaseDeferred( DeferredBase& col )
+{
+    deferred_.erase( std::remove( deferred_.begin(), deferred_.end(), &col ), deferred_.end() );
+}
+
+DeferredBase::DeferredBase( const DeferredBase& )
+{
+}
+
+DeferredBase& DeferredBase::operator= ( const DeferredBase& )
+{
+    return *this;
+}
+
+DeferredBase::~DeferredBase()
+{
+    if ( stmt_ )
+    {
+        stmt_->releaseDeferred( *this );
+    }
+}
+
+void Statement::doGetData( const unsigned short col, const BindingPlan& plan, void* const base )
+{
+    const auto& binding = plan.cols_.front();
+    auto* const data = static_cast< char* >( base );
+
+    check( ::SQLGetData(
+        stmt_,
+        col,
+        binding.cType,
+        data + binding.data,
+        binding.size,
+        binding.indicator >= 0 ? reinterpret_cast< SQLLEN* >( data + binding.indicator ) : nullptr
+    ), SQL_HANDLE_STMT, stmt_ );
+}
+
+void Statement::doPointBindings( const int descriptor, const std::vector< BindingPlan::Binding >& bindings, const char* const base )
+{
+    SQLHDESC desc;
+    check( ::SQLGetStmtAttr( stmt_, descriptor, &desc, 0, nullptr ), SQL_HANDLE_STMT, stmt_ );
+
+    pointRecords( desc, bindings, base );
+}
+
+void Statement::doBindParamArray( const std::size_t size, const std::size_t count )
+{
+    setAttr( SQL_ATTR_PARAM_BIND_TYPE, (SQLPOINTER) size );
+    setAttr( SQL_ATTR_PARAMSET_SIZE, (SQLPOINTER) count );
+}
+
+void Statement::doBindColArray( const std::size_t size, const std::size_t count, long* const rowsFetched )
+{
+    setAttr( SQL_ATTR_ROW_BIND_TYPE, (SQLPOINTER) size );
+    setAttr( SQL_ATTR_ROW_ARRAY_SIZE, (SQLPOINTER) count );
+    setAttr( SQL_ATTR_ROWS_FETCHED_PTR, rowsFetched );
+}
+
+template< typename Derived >
+template< typename Param >
+Derived& Binder< Derived >::doBindParam( const Param* const data, const long* const indicator )
+{
+    using ParamTraits = OdbcTraits< Param >;
+
+    return derived().doBindParam( data, ParamTraits::CType, ParamTraits::SqlType, sizeof ( Param ), 0, indicator );
+}
+
+template< typename Derived >
+template< typename Col >
+Derived& Binder< Derived >::doBindCol( Col* const data, long* const indicator )
+{
+    using ColTraits = OdbcTraits< Col >;
+
+    return derived().doBindCol( data, ColTraits::CType, sizeof ( Col ), indicator );
+
+}
+
+Statement& Statement::doBindParam( const void* const data, const short cType, const short sqlType, const std::size_t size, const std::size_t length, const long* const indicator )
+{
+    check( ::SQLBindParameter(
         stmt_,
         ++param_,
-        SQL_PARAM_INPUT,
+        static_cast< SQLSMALLINT >( direction_ ),
         cType,
         sqlType,
         length,
@@ -274,6 +1656,11 @@ Statement& Statement::doBindParam( const void* const data, const short cType, co
         (SQLLEN*) indicator
     ), SQL_HANDLE_STMT, stmt_ );
 
+    if ( bindValidation_ != BindValidation::Off )
+    {
+        validateParam( sqlType, length );
+    }
+
     return *this;
 }
 
@@ -288,7 +1675,15 @@ Statement& Statement::doBindCol( void* const data, const short cType, const std:
         indicator
     ), SQL_HANDLE_STMT, stmt_ );
 
+    if ( bindValidation_ != BindValidation::Off )
+    {
+        validateCol( cType, size );
+    }
+
     return *this;
 }
 
+template class Binder< Statement >;
+template class Binder< BindingRecorder >;
+
 }
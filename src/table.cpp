@@ -20,12 +20,76 @@ along with rodbc.  If not, see <http://www.gnu.org/licenses/>.
 */
 #include "table.ipp"
 
+#include "connection.hpp"
 #include "statement.hpp"
 
+#include <algorithm>
 #include <sstream>
 
 namespace rodbc
 {
+namespace
+{
+
+void insertColumns( std::ostream& stmt, const std::string* const columnNames, const std::initializer_list< std::size_t >& value )
+{
+    stmt << " (";
+
+    for ( auto column = value.begin(); column != value.end(); ++column )
+    {
+        if ( column != value.begin() )
+        {
+            stmt << ", ";
+        }
+
+        stmt << columnNames[ *column ];
+    }
+
+    stmt << ')';
+}
+
+bool consecutiveInsertIds( Connection& conn )
+{
+    std::int64_t increment, lockMode;
+
+    Statement stmt{ conn, "SELECT @@auto_increment_increment, @@innodb_autoinc_lock_mode" };
+    stmt.bindCol( increment );
+    stmt.bindCol( lockMode );
+    stmt.exec();
+
+    // Interleaved lock mode or a custom increment break up the keys generated by a multi-row insert.
+    return stmt.fetch() && increment == 1 && lockMode != 2;
+}
+
+void insertValues( std::ostream& stmt, const std::size_t numberOfValues, const std::size_t rows )
+{
+    stmt << " VALUES ";
+
+    for ( std::size_t row = 0; row != rows; ++row )
+    {
+        if ( row != 0 )
+        {
+            stmt << ", ";
+        }
+
+        stmt << '(';
+
+        for ( std::size_t column = 0; column != numberOfValues; ++column )
+        {
+            if ( column != 0 )
+            {
+                stmt << ", ";
+            }
+
+            stmt << '?';
+        }
+
+        stmt << ')';
+    }
+}
+
+}
+
 namespace detail
 {
 
@@ -161,33 +225,125 @@ std::string insert(
 {
     std::ostringstream stmt;
 
-    stmt << "INSERT INTO " << tableName << " (";
+    stmt << "INSERT INTO " << tableName;
 
-    for ( auto column = value.begin(); column != value.end(); ++column )
+    insertColumns( stmt, columnNames, value );
+    insertValues( stmt, value.size(), 1 );
+
+    return stmt.str();
+}
+
+std::string bulkAdd(
+    const std::string& tableName,
+    const std::string* const columnNames, const std::size_t numberOfColumns
+)
+{
+    return select( tableName, columnNames, numberOfColumns, {} ) + " WHERE 1 = 0";
+}
+
+std::string insertReturning(
+    const DBMS dbms,
+    const std::string& tableName,
+    const std::string* const columnNames,
+    const std::initializer_list< std::size_t >& value,
+    const std::size_t key,
+    const std::size_t rows
+)
+{
+    std::ostringstream stmt;
+
+    stmt << "INSERT INTO " << tableName;
+
+    insertColumns( stmt, columnNames, value );
+
+    switch ( dbms )
     {
-        if ( column != value.begin() )
-        {
-            stmt << ", ";
-        }
+    case DBMS::PostgreSQL:
+        insertValues( stmt, value.size(), rows );
+        stmt << " RETURNING " << columnNames[ key ];
+        break;
+    case DBMS::SQLServer:
+        stmt << " OUTPUT INSERTED." << columnNames[ key ];
+        insertValues( stmt, value.size(), rows );
+        break;
+    case DBMS::SQLite:
+    case DBMS::MySQL:
+        insertValues( stmt, value.size(), rows );
+        break;
+    default:
+        throw Exception{ "IM001", "Generated keys are not supported for this DBMS." };
+    }
 
-        stmt << columnNames[ *column ];
+    return stmt.str();
+}
+
+bool returnsKeys( const DBMS dbms )
+{
+    return dbms == DBMS::PostgreSQL || dbms == DBMS::SQLServer;
+}
+
+std::int64_t firstInsertId( Connection& conn, const std::size_t rows )
+{
+    const auto dbms = conn.dbms();
+
+    std::int64_t id;
+
+    Statement stmt{ conn, dbms == DBMS::SQLite ? "SELECT last_insert_rowid()" : "SELECT LAST_INSERT_ID()" };
+    stmt.bindCol( id );
+    stmt.exec();
+
+    if ( !stmt.fetch() )
+    {
+        throw Exception{ "HY000", "Could not determine the generated keys." };
     }
 
-    stmt << ") VALUES (";
+    // SQLite reports the key of the last row whereas MySQL reports the key of the first row of a multi-row insert.
+    return dbms == DBMS::SQLite ? id - static_cast< std::int64_t >( rows ) + 1 : id;
+}
 
-    for ( std::size_t column = 0; column != value.size(); ++column )
+std::string selectByRowId(
+    const std::string& tableName,
+    const std::string* const columnNames,
+    const std::size_t key
+)
+{
+    std::ostringstream stmt;
+
+    stmt << "SELECT " << columnNames[ key ] << " FROM " << tableName << " WHERE rowid BETWEEN ? AND ? ORDER BY rowid";
+
+    return stmt.str();
+}
+
+std::size_t insertReturningRows( Connection& conn, const std::size_t numberOfValues )
+{
+    switch ( conn.dbms() )
     {
-        if ( column != 0 )
+    case DBMS::SQLServer:
+        // The order of the rows produced by an OUTPUT clause is unspecified.
+        return 1;
+    case DBMS::MySQL:
+        if ( !consecutiveInsertIds( conn ) )
         {
-            stmt << ", ";
+            return 1;
         }
-
-        stmt << '?';
+        break;
+    default:
+        break;
     }
 
-    stmt << ')';
+    // Stay below the smallest common limits on the number of parameters and rows of a single statement.
+    constexpr std::size_t maxParams = 999;
+    constexpr std::size_t maxRows = 1000;
 
-    return stmt.str();
+    return std::max< std::size_t >( 1, std::min( maxRows, maxParams / numberOfValues ) );
+}
+
+void checkKeys( const std::size_t rows, const std::size_t keys )
+{
+    if ( rows != keys )
+    {
+        throw Exception{ "HY000", "The number of generated keys does not match the number of inserted rows." };
+    }
 }
 
 std::string update(
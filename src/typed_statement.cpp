@@ -0,0 +1,351 @@
+/*
+
+Copyright 2017 Adam Reichold
+
+This file is part of rodbc.
+
+rodbc is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+rodbc is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with rodbc.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#include "typed_statement.hpp"
+
+#include <algorithm>
+#include <exception>
+
+namespace rodbc
+{
+namespace detail
+{
+
+void ParamArrayStatus::bind( Statement& stmt, const std::size_t size )
+{
+    if ( bound_ && status_.size() == size )
+    {
+        return;
+    }
+
+    status_.resize( size );
+    execStatus_.resize( size );
+    operations_.resize( size );
+
+    if ( continueOnError_ )
+    {
+        stmt.bindParamStatus( execStatus_.data(), processed_ );
+        stmt.bindParamOperations( operations_.data() );
+    }
+    else
+    {
+        stmt.bindParamStatus( status_.data(), processed_ );
+        stmt.bindParamOperations( nullptr );
+    }
+
+    bound_ = true;
+}
+
+void ParamArrayStatus::exec( Statement& stmt )
+{
+    begin();
+
+    for ( ;; )
+    {
+        std::exception_ptr error;
+
+        try
+        {
+            stmt.exec();
+        }
+        catch ( Exception& )
+        {
+            error = std::current_exception();
+        }
+
+        switch ( complete( error != nullptr ) )
+        {
+        case Outcome::Failed:
+            std::rethrow_exception( error );
+        case Outcome::Completed:
+            return;
+        case Outcome::Retry:
+            break;
+        }
+    }
+}
+
+bool ParamArrayStatus::pollExec( Statement& stmt )
+{
+    if ( !executing_ )
+    {
+        begin();
+
+        executing_ = true;
+    }
+
+    for ( ;; )
+    {
+        std::exception_ptr error;
+
+        try
+        {
+            if ( !stmt.pollExec() )
+            {
+                return false;
+            }
+        }
+        catch ( Exception& )
+        {
+            error = std::current_exception();
+        }
+
+        switch ( complete( error != nullptr ) )
+        {
+        case Outcome::Failed:
+            executing_ = false;
+            std::rethrow_exception( error );
+        case Outcome::Completed:
+            executing_ = false;
+            return true;
+        case Outcome::Retry:
+            break;
+        }
+    }
+}
+
+Status ParamArrayStatus::tryExec( Statement& stmt )
+{
+    begin();
+
+    for ( ;; )
+    {
+        const auto status = stmt.tryExec();
+
+        switch ( complete( !status ) )
+        {
+        case Outcome::Failed:
+            return status;
+        case Outcome::Completed:
+            return {};
+        case Outcome::Retry:
+            break;
+        }
+    }
+}
+
+void ParamArrayStatus::begin()
+{
+    if ( !continueOnError_ )
+    {
+        std::fill( status_.begin(), status_.end(), ParamStatus::DiagnosticsUnavailable );
+
+        return;
+    }
+
+    std::fill( status_.begin(), status_.end(), ParamStatus::Unused );
+    std::fill( operations_.begin(), operations_.end(), ParamOperation::Proceed );
+    std::fill( execStatus_.begin(), execStatus_.end(), ParamStatus::DiagnosticsUnavailable );
+}
+
+ParamArrayStatus::Outcome ParamArrayStatus::complete( const bool failed )
+{
+    if ( !continueOnError_ )
+    {
+        return failed ? Outcome::Failed : Outcome::Completed;
+    }
+
+    // Parameter sets the driver did not get to before giving up are marked as unused
+    // and are retried by ignoring all parameter sets which have been processed so far.
+    bool reported = false;
+    bool progressed = false;
+    bool remaining = false;
+
+    for ( std::size_t index = 0; index != status_.size(); ++index )
+    {
+        if ( operations_[ index ] == ParamOperation::Ignore )
+        {
+            continue;
+        }
+
+        const auto status = execStatus_[ index ];
+
+        if ( status != ParamStatus::DiagnosticsUnavailable )
+        {
+            reported = true;
+        }
+
+        if ( status == ParamStatus::Unused )
+        {
+            remaining = true;
+
+            continue;
+        }
+
+        status_[ index ] = status;
+        operations_[ index ] = ParamOperation::Ignore;
+
+        progressed = true;
+    }
+
+    if ( failed && ( !reported || ( remaining && !progressed ) ) )
+    {
+        return Outcome::Failed;
+    }
+
+    if ( remaining && progressed )
+    {
+        std::fill( execStatus_.begin(), execStatus_.end(), ParamStatus::DiagnosticsUnavailable );
+
+        return Outcome::Retry;
+    }
+
+    processed_ = std::count_if( status_.begin(), status_.end(), []( const ParamStatus status )
+    {
+        return status != ParamStatus::Unused;
+    } );
+
+    return Outcome::Completed;
+}
+
+const std::vector< ParamStatus >& ParamArrayStatus::status() const
+{
+    return status_;
+}
+
+std::size_t ParamArrayStatus::processed() const
+{
+    return processed_;
+}
+
+bool ParamArrayStatus::continueOnError() const
+{
+    return continueOnError_;
+}
+
+void ParamArrayStatus::setContinueOnError( const bool continueOnError )
+{
+    if ( continueOnError_ != continueOnError )
+    {
+        continueOnError_ = continueOnError;
+        bound_ = false;
+    }
+}
+
+namespace
+{
+
+constexpr std::size_t initialFetchSize = 16;
+constexpr double rowsPerExecWeight = 0.5;
+constexpr double minimumSpeedup = 1.1;
+constexpr double throughputWeight = 0.5;
+constexpr std::size_t samplesPerFetchSize = 3;
+
+inline std::size_t roundUpToPowerOfTwo( const std::size_t value )
+{
+    std::size_t result = 1;
+
+    while ( result < value )
+    {
+        result *= 2;
+    }
+
+    return result;
+}
+
+}
+
+bool AdaptiveFetchSize::enabled() const
+{
+    return maxRows_ != 0;
+}
+
+void AdaptiveFetchSize::setMaxRows( const std::size_t maxRows )
+{
+    maxRows_ = maxRows;
+    fetchSize_ = std::min( fetchSize_, maxRows_ );
+}
+
+std::size_t AdaptiveFetchSize::fetchSize() const
+{
+    return fetchSize_;
+}
+
+void AdaptiveFetchSize::exec()
+{
+    if ( executions_ == 1 )
+    {
+        rowsPerExec_ = rows_;
+    }
+    else if ( executions_ > 1 )
+    {
+        rowsPerExec_ += rowsPerExecWeight * ( rows_ - rowsPerExec_ );
+    }
+
+    // One additional row lets a partial row set signal the end of the result without another round trip.
+    const auto fetchSize = executions_ != 0 ? roundUpToPowerOfTwo( static_cast< std::size_t >( rowsPerExec_ ) + 1 ) : initialFetchSize;
+
+    fetchSize_ = std::min( fetchSize, maxRows_ );
+
+    rows_ = 0;
+    ++executions_;
+
+    sampledFetchSize_ = 0;
+    samples_ = 0;
+    throughput_ = 0.0;
+    previousThroughput_ = 0.0;
+    saturated_ = false;
+}
+
+void AdaptiveFetchSize::fetched( const std::size_t rows, const std::size_t fetchSize, const std::chrono::steady_clock::duration latency )
+{
+    rows_ += rows;
+
+    if ( rows < fetchSize || saturated_ || fetchSize >= maxRows_ )
+    {
+        return;
+    }
+
+    const auto seconds = std::chrono::duration< double >( latency ).count();
+
+    if ( seconds <= 0.0 )
+    {
+        return;
+    }
+
+    const auto throughput = rows / seconds;
+
+    if ( sampledFetchSize_ != fetchSize )
+    {
+        sampledFetchSize_ = fetchSize;
+        samples_ = 0;
+    }
+
+    // Smooth the throughput over several fetches so that a single noisy sample neither stops nor drives growth.
+    throughput_ = samples_ != 0 ? throughput_ + throughputWeight * ( throughput - throughput_ ) : throughput;
+
+    if ( ++samples_ < samplesPerFetchSize )
+    {
+        return;
+    }
+
+    if ( previousThroughput_ != 0.0 && throughput_ < minimumSpeedup * previousThroughput_ )
+    {
+        saturated_ = true;
+
+        return;
+    }
+
+    previousThroughput_ = throughput_;
+    fetchSize_ = std::min( 2 * fetchSize, maxRows_ );
+}
+
+}
+}
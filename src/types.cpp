@@ -41,6 +41,24 @@ namespace rodbc
 namespace
 {
 
+inline bool isConstraintViolation( const char* const state, const int nativeError )
+{
+    const auto odbcIntegrityConstraintViolation = std::strncmp( state, "23", 2 ) == 0;
+    const auto sqliteConstraint = std::strcmp( state, "HY000" ) == 0 && nativeError == 19;
+
+    return odbcIntegrityConstraintViolation || sqliteConstraint;
+}
+
+inline bool isCancelled( const char* const state, const int nativeError )
+{
+    const auto odbcOperationCanceled = std::strcmp( state, "HY008" ) == 0;
+    const auto postgresqlQueryCanceled = std::strcmp( state, "57014" ) == 0;
+    const auto mysqlQueryInterrupted = nativeError == 1317;
+    const auto sqliteInterrupt = std::strcmp( state, "HY000" ) == 0 && nativeError == 9;
+
+    return odbcOperationCanceled || postgresqlQueryCanceled || mysqlQueryInterrupted || sqliteInterrupt;
+}
+
 template< typename Integer, typename Generator >
 void fromInteger( const Integer int_val, char* const str_val, long& str_ind, const std::size_t str_len )
 {
@@ -138,17 +156,18 @@ void assign( char* const dst, long& dst_ind, const char* const src )
 
 int compare( const char* const lhs, const long lhs_ind, const char* const rhs, const long rhs_ind )
 {
-    if ( lhs_ind < 0 )
+    if ( lhs_ind < 0 || rhs_ind < 0 )
     {
-        return -1;
+        // Null values are equal to each other and order before all other values.
+        return ( rhs_ind < 0 ) - ( lhs_ind < 0 );
     }
 
-    if ( rhs_ind < 0 )
+    if ( const auto result = std::memcmp( lhs, rhs, std::min( lhs_ind, rhs_ind ) ) )
     {
-        return +1;
+        return result;
     }
 
-    return std::memcmp( lhs, rhs, std::min( lhs_ind, rhs_ind ) );
+    return lhs_ind < rhs_ind ? -1 : lhs_ind > rhs_ind ? +1 : 0;
 }
 
 std::string str( const char* const val, const long ind )
@@ -234,6 +253,14 @@ Exception::Exception( const short type, void* const handle )
     message_ = "ODBC diagnostic record could not be retrieved.";
 }
 
+Exception::Exception( const char* const state, std::string message )
+: nativeError_{ 0 }
+, message_{ std::move( message ) }
+{
+    std::strncpy( state_, state, sizeof ( state_ ) - 1 );
+    state_[ sizeof ( state_ ) - 1 ] = '\0';
+}
+
 const char* Exception::state() const noexcept
 {
     return state_;
@@ -249,12 +276,14 @@ bool Exception::isTimeout() const noexcept
     return std::strcmp( state_, "HYT00" ) == 0;
 }
 
-bool Exception::isConstraintViolation() const noexcept
+bool Exception::isCancelled() const noexcept
 {
-    const auto odbcIntegrityConstraintViolation = std::strncmp( state_, "23", 2 ) == 0;
-    const auto sqliteConstraint = std::strcmp( state_, "HY000" ) == 0 && nativeError_ == 19;
+    return rodbc::isCancelled( state_, nativeError_ );
+}
 
-    return odbcIntegrityConstraintViolation || sqliteConstraint;
+bool Exception::isConstraintViolation() const noexcept
+{
+    return rodbc::isConstraintViolation( state_, nativeError_ );
 }
 
 const char* Exception::what() const noexcept
@@ -262,6 +291,140 @@ const char* Exception::what() const noexcept
     return message_.c_str();
 }
 
+Status::Status()
+: state_{ "00000" }
+, nativeError_{ 0 }
+, type_{ 0 }
+, handle_{ nullptr }
+, message_{ nullptr }
+{
+}
+
+Status::Status( const short type, void* const handle )
+: state_{ "HY000" }
+, nativeError_{ 0 }
+, type_{ type }
+, handle_{ handle }
+, message_{ nullptr }
+{
+    SQLSMALLINT messageLength;
+
+    ::SQLGetDiagRec( type, handle, 1, (SQLCHAR*) state_, &nativeError_, nullptr, 0, &messageLength );
+}
+
+Status::Status( const char* const state, const char* const message )
+: nativeError_{ 0 }
+, type_{ 0 }
+, handle_{ nullptr }
+, message_{ message }
+{
+    std::strncpy( state_, state, sizeof ( state_ ) - 1 );
+    state_[ sizeof ( state_ ) - 1 ] = '\0';
+}
+
+bool Status::ok() const noexcept
+{
+    return handle_ == nullptr && message_ == nullptr;
+}
+
+Status::operator bool() const noexcept
+{
+    return ok();
+}
+
+const char* Status::state() const noexcept
+{
+    return state_;
+}
+
+int Status::nativeError() const noexcept
+{
+    return nativeError_;
+}
+
+bool Status::isTimeout() const noexcept
+{
+    return std::strcmp( state_, "HYT00" ) == 0;
+}
+
+bool Status::isCancelled() const noexcept
+{
+    return rodbc::isCancelled( state_, nativeError_ );
+}
+
+bool Status::isConstraintViolation() const noexcept
+{
+    return rodbc::isConstraintViolation( state_, nativeError_ );
+}
+
+std::string Status::message() const
+{
+    if ( ok() )
+    {
+        return {};
+    }
+
+    if ( message_ )
+    {
+        return message_;
+    }
+
+    return Exception{ type_, handle_ }.what();
+}
+
+void Status::raise() const
+{
+    if ( message_ )
+    {
+        throw Exception{ state_, message_ };
+    }
+
+    if ( !ok() )
+    {
+        throw Exception{ type_, handle_ };
+    }
+}
+
+LongParam::LongParam( const bool binary )
+: ind_{ SQL_NULL_DATA }
+, binary_{ binary }
+{
+}
+
+LongParam::LongParam( Source source, const bool binary )
+: source_{ std::move( source ) }
+, ind_{ source_ ? SQL_LEN_DATA_AT_EXEC( 0 ) : SQL_NULL_DATA }
+, binary_{ binary }
+{
+}
+
+bool LongParam::isNull() const
+{
+    return ind_ == SQL_NULL_DATA;
+}
+
+void LongParam::clear()
+{
+    source_ = nullptr;
+    ind_ = SQL_NULL_DATA;
+}
+
+bool LongParam::isBinary() const
+{
+    return binary_;
+}
+
+const LongParam::Source& LongParam::source() const
+{
+    return source_;
+}
+
+void LongParam::setSource( Source source )
+{
+    source_ = std::move( source );
+    ind_ = source_ ? SQL_LEN_DATA_AT_EXEC( 0 ) : SQL_NULL_DATA;
+}
+
 bool operator== ( const Timestamp& lhs, const Timestamp& rhs )
 {
     return toPTime( lhs ) == toPTime( rhs );
@@ -21,6 +21,7 @@ along with rodbc.  If not, see <http://www.gnu.org/licenses/>.
 #pragma once
 
 #include "connection_pool.hpp"
+#include "typed_statement.hpp"
 
 #include <boost/fusion/include/define_struct.hpp>
 
@@ -123,7 +124,7 @@ public:
     struct SelectBarByA : private Statement
     {
         float& a;
-        const std::vector< Bar >& bar;
+        const rodbc::FetchBuffer< Bar >& bar;
 
         SelectBarByA( Transaction& transaction );
 
@@ -0,0 +1,190 @@
+/*
+
+Copyright 2017 Adam Reichold
+
+This file is part of rodbc.
+
+rodbc is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+rodbc is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with rodbc.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#include "async_poller.ipp"
+
+#include "result_set.ipp"
+#include "typed_statement.ipp"
+
+#include "fixture.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <algorithm>
+
+namespace
+{
+
+void createTableAndInsertValues( rodbc::Connection& conn )
+{
+    rodbc::CreateTable< std::tuple< int >, 0 >{
+        conn, "tbl", { "col" },
+        rodbc::DROP_TABLE_IF_EXISTS | rodbc::TEMPORARY_TABLE
+    };
+
+    rodbc::TypedStatement< std::vector< std::tuple< int > >, std::tuple<> > stmt{
+        conn, "INSERT INTO tbl (col) VALUES (?)"
+    };
+
+    for ( int index = 0; index < 128; ++index )
+    {
+        stmt.params().emplace_back( index );
+    }
+
+    stmt.exec();
+}
+
+}
+
+BOOST_FIXTURE_TEST_SUITE( asyncPoller, Fixture )
+
+BOOST_AUTO_TEST_CASE( canExecuteAndFetchUsingFutures )
+{
+    createTableAndInsertValues( conn );
+
+    rodbc::AsyncPoller poller;
+
+    rodbc::TypedStatement< std::tuple<>, std::vector< std::tuple< int > > > stmt{
+        conn, "SELECT col FROM tbl ORDER BY col", 32
+    };
+
+    BOOST_CHECK_NO_THROW( rodbc::execAsync( poller, stmt ).get() );
+    BOOST_CHECK( rodbc::fetchAsync( poller, stmt ).get() );
+
+    int index = 0;
+
+    for ( const auto& row : rodbc::ResultSet< std::tuple< int > >{ stmt, true } )
+    {
+        BOOST_CHECK_EQUAL( index++, std::get< 0 >( row ) );
+    }
+
+    BOOST_CHECK_EQUAL( 128, index );
+}
+
+BOOST_AUTO_TEST_CASE( canExecuteUsingCallbacks )
+{
+    createTableAndInsertValues( conn );
+
+    rodbc::TypedStatement< std::tuple<>, std::tuple< int > > stmt{
+        conn, "SELECT COUNT(*) FROM tbl"
+    };
+
+    std::promise< int > count;
+
+    {
+        rodbc::AsyncPoller poller;
+
+        rodbc::execAsync( poller, stmt, [ & ]( std::exception_ptr error )
+        {
+            if ( error )
+            {
+                count.set_exception( error );
+                return;
+            }
+
+            rodbc::fetchAsync( poller, stmt, [ & ]( const bool result, std::exception_ptr error )
+            {
+                if ( error )
+                {
+                    count.set_exception( error );
+                }
+                else
+                {
+                    count.set_value( result ? std::get< 0 >( stmt.cols() ) : -1 );
+                }
+            } );
+        } );
+    }
+
+    BOOST_CHECK_EQUAL( 128, count.get_future().get() );
+}
+
+BOOST_AUTO_TEST_CASE( canReportErrorsUsingFutures )
+{
+    createTableAndInsertValues( conn );
+
+    rodbc::AsyncPoller poller;
+
+    rodbc::TypedStatement< std::tuple< int >, std::tuple<> > stmt{
+        conn, "INSERT INTO tbl (col) VALUES (?)"
+    };
+
+    std::get< 0 >( stmt.params() ) = 0;
+
+    auto result = rodbc::execAsync( poller, stmt );
+
+    BOOST_CHECK_EXCEPTION( result.get(), rodbc::Exception, std::mem_fn( &rodbc::Exception::isConstraintViolation ) );
+}
+
+BOOST_AUTO_TEST_CASE( canExecuteParamArrays )
+{
+    createTableAndInsertValues( conn );
+
+    rodbc::AsyncPoller poller;
+
+    rodbc::TypedStatement< std::vector< std::tuple< int > >, std::tuple<> > stmt{
+        conn, "INSERT INTO tbl (col) VALUES (?)"
+    };
+
+    for ( int index = 128; index < 256; ++index )
+    {
+        stmt.params().emplace_back( index );
+    }
+
+    BOOST_CHECK_NO_THROW( rodbc::execAsync( poller, stmt ).get() );
+
+    rodbc::TypedStatement< std::tuple<>, std::tuple< int > > countStmt{
+        conn, "SELECT COUNT(*) FROM tbl"
+    };
+
+    countStmt.exec();
+    BOOST_REQUIRE( countStmt.fetch() );
+    BOOST_CHECK_EQUAL( 256, std::get< 0 >( countStmt.cols() ) );
+}
+
+BOOST_AUTO_TEST_CASE( canStreamLongParams )
+{
+    rodbc::Statement{ conn, "DROP TABLE IF EXISTS tbl" }.exec();
+    rodbc::Statement{ conn, "CREATE TEMPORARY TABLE tbl (col TEXT)" }.exec();
+
+    const std::size_t size = 64 * 1024;
+    std::size_t offset = 0;
+
+    rodbc::LongParam param{ [ &offset, size ]( char* const data, const std::size_t capacity )
+    {
+        const auto chunk = std::min( capacity, size - offset );
+
+        std::fill_n( data, chunk, 'a' );
+
+        offset += chunk;
+
+        return chunk;
+    } };
+
+    rodbc::Statement stmt{ conn, "INSERT INTO tbl (col) VALUES (?)" };
+    stmt.bindParam( param );
+
+    rodbc::AsyncPoller poller;
+
+    BOOST_CHECK_NO_THROW( rodbc::execAsync( poller, stmt ).get() );
+    BOOST_CHECK_EQUAL( size, offset );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,81 @@
+/*
+
+Copyright 2017 Adam Reichold
+
+This file is part of rodbc.
+
+rodbc is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+rodbc is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with rodbc.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#include "batch.ipp"
+
+#include "fixture.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+
+void insertAndSelect( rodbc::Connection& conn, rodbc::Batch& batch )
+{
+    CreateSimpleTable< int >{ conn };
+
+    auto& insertOne = batch.add< std::tuple< int > >( "INSERT INTO tbl (col) VALUES (?)" );
+    auto& insertTwo = batch.add< std::tuple< int > >( "INSERT INTO tbl (col) VALUES (?)" );
+    auto& selectAll = batch.add< std::tuple<>, std::tuple< int > >( "SELECT col FROM tbl ORDER BY col" );
+    auto& selectCount = batch.add< std::tuple<>, std::tuple< int > >( "SELECT COUNT(*) FROM tbl" );
+
+    for ( int index = 0; index < 3; ++index )
+    {
+        std::get< 0 >( insertOne.params() ) = 2 * index;
+        std::get< 0 >( insertTwo.params() ) = 2 * index + 1;
+
+        BOOST_CHECK_NO_THROW( batch.exec() );
+
+        const auto& rows = selectAll.rows();
+        BOOST_REQUIRE_EQUAL( 2 * index + 2, rows.size() );
+
+        for ( int row = 0; row < 2 * index + 2; ++row )
+        {
+            BOOST_CHECK_EQUAL( row, std::get< 0 >( rows[ row ] ) );
+        }
+
+        BOOST_REQUIRE_EQUAL( 1, selectCount.rows().size() );
+        BOOST_CHECK_EQUAL( 2 * index + 2, std::get< 0 >( selectCount.rows().front() ) );
+    }
+}
+
+}
+
+BOOST_FIXTURE_TEST_SUITE( batch, Fixture )
+
+BOOST_AUTO_TEST_CASE( canExecuteBatch )
+{
+    rodbc::Batch batch{ conn };
+
+    BOOST_TEST_MESSAGE( "Batched execution is " << ( batch.batched() ? "supported." : "not supported." ) );
+
+    insertAndSelect( conn, batch );
+}
+
+BOOST_AUTO_TEST_CASE( canExecuteSequentially )
+{
+    rodbc::Batch batch{ conn, false };
+
+    BOOST_CHECK( !batch.batched() );
+
+    insertAndSelect( conn, batch );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
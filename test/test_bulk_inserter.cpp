@@ -0,0 +1,97 @@
+/*
+
+Copyright 2017 Adam Reichold
+
+This file is part of rodbc.
+
+rodbc is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+rodbc is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with rodbc.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#include "bulk_inserter.ipp"
+
+#include "fixture.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+BOOST_FIXTURE_TEST_SUITE( bulkInserter, Fixture )
+
+BOOST_AUTO_TEST_CASE( canInsertUsingBothBuffers )
+{
+    rodbc::CreateTable< std::tuple< int, int >, 0 >{
+        conn, "tbl", { "x", "y" },
+        rodbc::DROP_TABLE_IF_EXISTS | rodbc::TEMPORARY_TABLE
+    };
+
+    {
+        rodbc::BulkInserter< std::tuple< int, int > > inserter{ conn, "INSERT INTO tbl (x, y) VALUES (?, ?)", 64 };
+
+        for ( int index = 0; index < 1000; ++index )
+        {
+            inserter.insert( std::make_tuple( index, 2 * index ) );
+        }
+
+        BOOST_CHECK_NO_THROW( inserter.flush() );
+    }
+
+    rodbc::TypedStatement< std::tuple<>, std::tuple< int, int > > stmt{
+        conn, "SELECT x, y FROM tbl ORDER BY x"
+    };
+
+    BOOST_CHECK_NO_THROW( stmt.exec() );
+
+    for ( int index = 0; index < 1000; ++index )
+    {
+        BOOST_REQUIRE( stmt.fetch() );
+
+        BOOST_CHECK_EQUAL( index, std::get< 0 >( stmt.cols() ) );
+        BOOST_CHECK_EQUAL( 2 * index, std::get< 1 >( stmt.cols() ) );
+    }
+
+    BOOST_CHECK( !stmt.fetch() );
+}
+
+BOOST_AUTO_TEST_CASE( canReportErrorsFromBackgroundThread )
+{
+    rodbc::CreateTable< std::tuple< int >, 0 >{
+        conn, "tbl", { "x" },
+        rodbc::DROP_TABLE_IF_EXISTS | rodbc::TEMPORARY_TABLE
+    };
+
+    rodbc::BulkInserter< std::tuple< int > > inserter{ conn, "INSERT INTO tbl (x) VALUES (?)", 8 };
+
+    for ( int index = 0; index < 8; ++index )
+    {
+        std::get< 0 >( inserter.next() ) = index;
+    }
+
+    BOOST_CHECK_NO_THROW( inserter.flush() );
+
+    std::get< 0 >( inserter.next() ) = 0;
+
+    BOOST_CHECK_EXCEPTION( inserter.flush(), rodbc::Exception, std::mem_fn( &rodbc::Exception::isConstraintViolation ) );
+}
+
+BOOST_AUTO_TEST_CASE( cannotUseEmptyBatches )
+{
+    rodbc::CreateTable< std::tuple< int >, 0 >{
+        conn, "tbl", { "x" },
+        rodbc::DROP_TABLE_IF_EXISTS | rodbc::TEMPORARY_TABLE
+    };
+
+    using Inserter = rodbc::BulkInserter< std::tuple< int > >;
+
+    BOOST_CHECK_THROW( Inserter( conn, "INSERT INTO tbl (x) VALUES (?)", 0 ), std::invalid_argument );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,128 @@
+/*
+
+Copyright 2017 Adam Reichold
+
+This file is part of rodbc.
+
+rodbc is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+rodbc is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with rodbc.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#include "call_statement.ipp"
+
+#include "fixture.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+
+bool createProcedure( rodbc::Connection& conn )
+{
+    switch ( conn.dbms() )
+    {
+    case rodbc::DBMS::MySQL:
+        rodbc::Statement{ conn, "DROP PROCEDURE IF EXISTS proc" }.exec();
+        rodbc::Statement{ conn, "CREATE PROCEDURE proc (IN x INT, OUT y INT, INOUT z INT) BEGIN SELECT x, z; SET y = 2 * x; SET z = z + x; END" }.exec();
+        return true;
+    case rodbc::DBMS::SQLServer:
+        rodbc::Statement{ conn, "IF OBJECT_ID('proc') IS NOT NULL DROP PROCEDURE proc" }.exec();
+        rodbc::Statement{ conn, "CREATE PROCEDURE proc @x INT, @y INT OUTPUT, @z INT OUTPUT AS BEGIN SELECT @x, @z; SET @y = 2 * @x; SET @z = @z + @x; END" }.exec();
+        return true;
+    default:
+        BOOST_TEST_MESSAGE( "Stored procedures are not defined for this DBMS." );
+        return false;
+    }
+}
+
+}
+
+BOOST_FIXTURE_TEST_SUITE( callStmt, Fixture )
+
+BOOST_AUTO_TEST_CASE( canCallProcedureWithOutputParameters )
+{
+    if ( !createProcedure( conn ) )
+    {
+        return;
+    }
+
+    rodbc::CallStatement< std::tuple< int >, std::tuple< int, rodbc::Nullable< int > >, std::tuple< int, rodbc::Nullable< int > > > outStmt{
+        conn, "{CALL proc(?, ?, ?)}"
+    };
+
+    std::get< 0 >( outStmt.params() ) = 21;
+
+    BOOST_CHECK_NO_THROW( outStmt.exec() );
+    BOOST_CHECK( outStmt.fetch() );
+    BOOST_CHECK_EQUAL( 21, std::get< 0 >( outStmt.cols() ) );
+    BOOST_CHECK( std::get< 1 >( outStmt.cols() ).isNull() );
+    BOOST_CHECK( !outStmt.fetch() );
+
+    BOOST_CHECK_EQUAL( 42, std::get< 0 >( outStmt.outParams() ) );
+    BOOST_CHECK( std::get< 1 >( outStmt.outParams() ).isNull() );
+
+    rodbc::CallStatement< std::tuple< int >, std::tuple< rodbc::Nullable< int >, rodbc::InOut< int > > > inOutStmt{
+        conn, "{CALL proc(?, ?, ?)}"
+    };
+
+    std::get< 0 >( inOutStmt.params() ) = 1;
+    std::get< 0 >( inOutStmt.outParams() ) = 7;
+    std::get< 1 >( inOutStmt.outParams() ).value = 41;
+
+    BOOST_CHECK_NO_THROW( inOutStmt.exec() );
+
+    BOOST_CHECK_EQUAL( 2, std::get< 0 >( inOutStmt.outParams() ).value( 0 ) );
+    BOOST_CHECK_EQUAL( 42, std::get< 1 >( inOutStmt.outParams() ).value );
+}
+
+BOOST_AUTO_TEST_CASE( canRecordParameterDirections )
+{
+    if ( !createProcedure( conn ) )
+    {
+        return;
+    }
+
+    struct Row
+    {
+        int x;
+        int y;
+        int z;
+    };
+
+    rodbc::BindingPlan plan;
+
+    {
+        Row row;
+
+        rodbc::BindingRecorder recorder{ plan, &row, sizeof ( row ) };
+        recorder.bindParam( row.x );
+        recorder.bindOutParam( row.y );
+        recorder.bindOutParam( row.z, rodbc::ParamDirection::InputOutput );
+    }
+
+    Row row{ 21, 0, 21 };
+
+    rodbc::Statement stmt{ conn, "{CALL proc(?, ?, ?)}" };
+    stmt.bindParams( plan, &row );
+
+    BOOST_CHECK_NO_THROW( stmt.exec() );
+
+    while ( stmt.moreResults() )
+    {
+    }
+
+    BOOST_CHECK_EQUAL( 42, row.y );
+    BOOST_CHECK_EQUAL( 42, row.z );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -59,6 +59,26 @@ void takeLeaseAndSelectButSplitUsage( Pool& pool )
     } );
 }
 
+template< typename Pool >
+void takeLeaseAndSelectAfterDeadline( Pool& pool )
+{
+    typename Pool::Lease lease{ pool };
+
+    lease.setDeadline( rodbc::Connection::Clock::now() - std::chrono::seconds{ 1 } );
+
+    lease( []( Statements& stmts )
+    {
+        BOOST_CHECK_EXCEPTION( stmts.selectStmt.exec(), rodbc::Exception, std::mem_fn( &rodbc::Exception::isTimeout ) );
+    } );
+
+    lease.setDeadline( rodbc::Connection::Clock::time_point::max() );
+
+    lease( []( Statements& stmts )
+    {
+        BOOST_CHECK_NO_THROW( stmts.selectStmt.exec() );
+    } );
+}
+
 BOOST_AUTO_TEST_SUITE( connPool )
 
 BOOST_AUTO_TEST_SUITE( threadLocalConnPool )
@@ -77,6 +97,13 @@ BOOST_AUTO_TEST_CASE( canSplitLeaseUsage )
     takeLeaseAndSelectButSplitUsage( pool );
 }
 
+BOOST_AUTO_TEST_CASE( canEnforceLeaseDeadline )
+{
+    rodbc::ThreadLocalConnectionPool< Statements > pool{ RODBC_TEST_CONN_STR };
+
+    takeLeaseAndSelectAfterDeadline( pool );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE( fixedSizeConnPool )
@@ -95,6 +122,13 @@ BOOST_AUTO_TEST_CASE( canSplitLeaseUsage )
     takeLeaseAndSelectButSplitUsage( pool );
 }
 
+BOOST_AUTO_TEST_CASE( canEnforceLeaseDeadline )
+{
+    rodbc::FixedSizeConnectionPool< Statements > pool{ RODBC_TEST_CONN_STR, 1ul };
+
+    takeLeaseAndSelectAfterDeadline( pool );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE_END()
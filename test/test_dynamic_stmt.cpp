@@ -0,0 +1,151 @@
+/*
+
+Copyright 2017 Adam Reichold
+
+This file is part of rodbc.
+
+rodbc is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+rodbc is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with rodbc.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#include "dynamic_statement.hpp"
+
+#include "table.ipp"
+
+#include "fixture.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+
+void populate( rodbc::Connection& conn )
+{
+    rodbc::CreateTable< std::tuple< int, double, rodbc::String< 32 > >, 0 >{
+        conn, "tbl", { "x", "y", "z" },
+        rodbc::DROP_TABLE_IF_EXISTS | rodbc::TEMPORARY_TABLE
+    };
+
+    rodbc::TypedStatement< std::vector< std::tuple< int, double, rodbc::String< 32 > > >, std::tuple<> > stmt{
+        conn, "INSERT INTO tbl (x, y, z) VALUES (?, ?, ?)"
+    };
+
+    for ( int index = 0; index < 100; ++index )
+    {
+        rodbc::String< 32 > z;
+
+        if ( index % 3 != 0 )
+        {
+            z = rodbc::String< 32 >{ std::to_string( index ) };
+        }
+
+        stmt.params().emplace_back( index, 0.5 * index, z );
+    }
+
+    stmt.exec();
+}
+
+void checkResults( rodbc::DynamicStatement& stmt )
+{
+    BOOST_REQUIRE_EQUAL( 3, stmt.cols().size() );
+
+    BOOST_CHECK( rodbc::DynamicStatement::CellType::Integer == stmt.cellType( 0 ) );
+    BOOST_CHECK( rodbc::DynamicStatement::CellType::Real == stmt.cellType( 1 ) );
+    BOOST_CHECK( rodbc::DynamicStatement::CellType::Text == stmt.cellType( 2 ) );
+
+    BOOST_CHECK_NO_THROW( stmt.exec() );
+
+    int index = 0;
+
+    while ( stmt.fetch() )
+    {
+        BOOST_CHECK_LE( stmt.rows(), 16 );
+
+        for ( std::size_t row = 0; row < stmt.rows(); ++row, ++index )
+        {
+            BOOST_CHECK_EQUAL( index, stmt.get< std::int64_t >( row, 0 ) );
+            BOOST_CHECK_EQUAL( 0.5 * index, stmt.get< double >( row, 1 ) );
+
+            if ( index % 3 != 0 )
+            {
+                BOOST_CHECK_EQUAL( std::to_string( index ), stmt.get< std::string >( row, 2 ) );
+            }
+            else
+            {
+                BOOST_CHECK( stmt.isNull( row, 2 ) );
+            }
+        }
+    }
+
+    BOOST_CHECK_EQUAL( 100, index );
+}
+
+}
+
+BOOST_FIXTURE_TEST_SUITE( dynamicStmt, Fixture )
+
+BOOST_AUTO_TEST_CASE( canFetchRowWise )
+{
+    populate( conn );
+
+    rodbc::DynamicStatement stmt{ conn, "SELECT x, y, z FROM tbl ORDER BY x", 16 };
+
+    checkResults( stmt );
+}
+
+BOOST_AUTO_TEST_CASE( canFetchColumnWise )
+{
+    populate( conn );
+
+    rodbc::DynamicStatement stmt{ conn, "SELECT x, y, z FROM tbl ORDER BY x", 16, rodbc::DynamicStatement::Layout::ColumnWise };
+
+    checkResults( stmt );
+}
+
+BOOST_AUTO_TEST_CASE( canBindParameters )
+{
+    populate( conn );
+
+    rodbc::DynamicStatement stmt{ conn, "SELECT x FROM tbl WHERE x >= ? ORDER BY x", 16 };
+
+    const int minimum = 90;
+    stmt.params().bindParam( minimum );
+
+    BOOST_CHECK_NO_THROW( stmt.exec() );
+
+    BOOST_REQUIRE( stmt.fetch() );
+    BOOST_CHECK_EQUAL( 10, stmt.rows() );
+    BOOST_CHECK_EQUAL( 90, stmt.get< std::int64_t >( 0, 0 ) );
+
+    BOOST_CHECK_THROW( stmt.get< std::string >( 0, 0 ), std::invalid_argument );
+}
+
+BOOST_AUTO_TEST_CASE( canDetectTruncation )
+{
+    populate( conn );
+
+    rodbc::DynamicStatement stmt{ conn, "SELECT z FROM tbl WHERE x IN (1, 10) ORDER BY x", 16, rodbc::DynamicStatement::Layout::RowWise, 1 };
+
+    BOOST_CHECK_NO_THROW( stmt.exec() );
+
+    BOOST_REQUIRE( stmt.fetch() );
+    BOOST_REQUIRE_EQUAL( 2, stmt.rows() );
+
+    BOOST_CHECK( !stmt.isTruncated( 0, 0 ) );
+    BOOST_CHECK_EQUAL( "1", stmt.get< std::string >( 0, 0 ) );
+
+    BOOST_CHECK( stmt.isTruncated( 1, 0 ) );
+    BOOST_CHECK_EQUAL( "1", stmt.get< std::string >( 1, 0 ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -93,4 +93,22 @@ BOOST_AUTO_TEST_CASE( canIterateThroughRowSets )
     BOOST_CHECK_EQUAL( 128 * ( 128 - 1 ) / 2, sum );
 }
 
+BOOST_AUTO_TEST_CASE( canIterateThroughColumnArrays )
+{
+    createTableAndInsertValues( conn );
+
+    rodbc::TypedStatement< std::tuple<>, rodbc::ColumnArrays< std::tuple< int > > > stmt{
+        conn, "SELECT col FROM tbl", 3
+    };
+
+    rodbc::ResultSet< std::tuple< int > > results{ stmt };
+
+    const auto sum = std::accumulate( results.begin(), results.end(), 0, []( const int sum, const std::tuple< int >& row )
+    {
+        return sum + std::get< 0 >( row );
+    } );
+
+    BOOST_CHECK_EQUAL( 128 * ( 128 - 1 ) / 2, sum );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
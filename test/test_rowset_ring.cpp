@@ -0,0 +1,135 @@
+/*
+
+Copyright 2017 Adam Reichold
+
+This file is part of rodbc.
+
+rodbc is free software: you can redistribute it and/or modify
+it under the terms of the GNU Lesser General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+rodbc is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU Lesser General Public License for more details.
+
+You should have received a copy of the GNU Lesser General Public License
+along with rodbc.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#include "rowset_ring.ipp"
+
+#include "fixture.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+#include <future>
+
+BOOST_FIXTURE_TEST_SUITE( rowsetRing, Fixture )
+
+BOOST_AUTO_TEST_CASE( canConsumeSlotsWhileFetching )
+{
+    rodbc::CreateTable< std::tuple< int, int >, 0 >{
+        conn, "tbl", { "x", "y" },
+        rodbc::DROP_TABLE_IF_EXISTS | rodbc::TEMPORARY_TABLE
+    };
+
+    {
+        rodbc::TypedStatement< std::vector< std::tuple< int, int > >, std::tuple<> > stmt{
+            conn, "INSERT INTO tbl (x, y) VALUES (?, ?)"
+        };
+
+        for ( int index = 0; index < 256; ++index )
+        {
+            stmt.params().emplace_back( index, 2 * index );
+        }
+
+        BOOST_CHECK_NO_THROW( stmt.exec() );
+    }
+
+    rodbc::RowsetRing< std::tuple< int, int > > ring{ 3, 16 };
+
+    rodbc::TypedStatement< std::tuple<>, rodbc::RowsetRing< std::tuple< int, int > > > stmt{
+        conn, "SELECT x, y FROM tbl ORDER BY x", ring
+    };
+
+    auto consumer = std::async( std::launch::async, [ &ring ]()
+    {
+        int index = 0;
+        std::size_t slot;
+
+        while ( ring.consume( slot ) )
+        {
+            for ( const auto& row : ring.rows( slot ) )
+            {
+                BOOST_CHECK_EQUAL( index, std::get< 0 >( row ) );
+                BOOST_CHECK_EQUAL( 2 * index, std::get< 1 >( row ) );
+
+                ++index;
+            }
+
+            ring.release( slot );
+        }
+
+        return index;
+    } );
+
+    BOOST_CHECK_NO_THROW( stmt.exec() );
+
+    while ( stmt.fetch() );
+
+    BOOST_CHECK_EQUAL( 256, consumer.get() );
+}
+
+BOOST_AUTO_TEST_CASE( canDetectInvalidSlots )
+{
+    using Ring = rodbc::RowsetRing< std::tuple< int > >;
+
+    BOOST_CHECK_THROW( Ring( 0, 16 ), std::invalid_argument );
+    BOOST_CHECK_THROW( Ring( 2, 0 ), std::invalid_argument );
+
+    CreateSimpleTable< int >{ conn };
+
+    {
+        rodbc::TypedStatement< std::vector< std::tuple< int > >, std::tuple<> > stmt{
+            conn, "INSERT INTO tbl (col) VALUES (?)"
+        };
+
+        for ( int index = 0; index < 4; ++index )
+        {
+            stmt.params().emplace_back( index );
+        }
+
+        BOOST_CHECK_NO_THROW( stmt.exec() );
+    }
+
+    Ring ring{ 2, 1 };
+
+    rodbc::TypedStatement< std::tuple<>, rodbc::RowsetRing< std::tuple< int > > > stmt{
+        conn, "SELECT col FROM tbl ORDER BY col", ring
+    };
+
+    BOOST_CHECK_NO_THROW( stmt.exec() );
+    BOOST_REQUIRE( stmt.fetch() );
+    BOOST_REQUIRE( stmt.fetch() );
+
+    BOOST_CHECK_THROW( ring.release( 0 ), std::invalid_argument );
+
+    std::size_t first, second;
+    BOOST_REQUIRE( ring.consume( first ) );
+    BOOST_REQUIRE( ring.consume( second ) );
+
+    BOOST_CHECK_THROW( ring.release( second ), std::invalid_argument );
+    BOOST_CHECK_NO_THROW( ring.release( first ) );
+    BOOST_CHECK_THROW( ring.release( first ), std::invalid_argument );
+    BOOST_CHECK_NO_THROW( ring.release( second ) );
+
+    BOOST_REQUIRE( stmt.fetch() );
+
+    // Executing again discards the slot which was not consumed.
+    BOOST_CHECK_NO_THROW( stmt.exec() );
+    BOOST_CHECK( stmt.fetch() );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -29,6 +29,13 @@ along with rodbc.  If not, see <http://www.gnu.org/licenses/>.
 #include <boost/mpl/list.hpp>
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <future>
+#include <memory>
+#include <sstream>
+#include <thread>
+
 namespace
 {
 
@@ -227,4 +234,564 @@ BOOST_AUTO_TEST_CASE( canInsertArrayOfStructs )
     }
 }
 
+BOOST_AUTO_TEST_CASE( canInsertArrayOfColumns )
+{
+    rodbc::Table< std::tuple< int, rodbc::Nullable< int >, rodbc::String< 32 > > > table{ conn, "tbl", { "x", "y", "z", } };
+    table.create( rodbc::DROP_TABLE_IF_EXISTS | rodbc::TEMPORARY_TABLE );
+
+    rodbc::ColumnArray< int > x;
+    rodbc::ColumnArray< rodbc::Nullable< int > > y;
+    rodbc::ColumnArray< rodbc::String< 32 > > z;
+
+    x.resize( 128 );
+    y.resize( 128 );
+    z.resize( 128 );
+    for ( int index = 0; index < 128; ++index )
+    {
+        x.set( index, index );
+        z.set( index, rodbc::String< 32 >{ std::to_string( index ) } );
+
+        if ( index % 2 == 0 )
+        {
+            y.set( index, 2 * index );
+        }
+    }
+
+    rodbc::Statement stmt{ conn, "INSERT INTO tbl (x, y, z) VALUES (?, ?, ?)" };
+    stmt.bindParam( x );
+    stmt.bindParam( y );
+    stmt.bindParam( z );
+    stmt.bindParamArrayByColumn( 128 );
+
+    BOOST_CHECK_NO_THROW( stmt.exec() );
+
+    const auto rows = collectResults( table.selectAll() );
+
+    BOOST_CHECK_EQUAL( 128, rows.size() );
+
+    for ( const auto& row : rows )
+    {
+        const auto index = std::get< 0 >( row );
+
+        if ( index % 2 == 0 )
+        {
+            BOOST_CHECK_EQUAL( 2 * index, std::get< 1 >( row ).value( -1 ) );
+        }
+        else
+        {
+            BOOST_CHECK( std::get< 1 >( row ).isNull() );
+        }
+
+        BOOST_CHECK_EQUAL( std::to_string( index ), std::get< 2 >( row ).str() );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( canStreamLongValues )
+{
+    rodbc::Statement{ conn, "DROP TABLE IF EXISTS tbl" }.exec();
+    rodbc::Statement{ conn, "CREATE TEMPORARY TABLE tbl (x INTEGER, y TEXT)" }.exec();
+
+    const std::size_t size = 256 * 1024;
+    std::size_t offset = 0;
+
+    int x;
+    rodbc::LongParam y{ [ &offset ]( char* const data, const std::size_t capacity )
+    {
+        const auto chunk = std::min( capacity, size - offset );
+
+        for ( std::size_t index = 0; index < chunk; ++index )
+        {
+            data[ index ] = 'a' + ( offset + index ) % 26;
+        }
+
+        offset += chunk;
+
+        return chunk;
+    } };
+
+    rodbc::Statement insertStmt{ conn, "INSERT INTO tbl (x, y) VALUES (?, ?)" };
+    insertStmt.bindParam( x );
+    insertStmt.bindParam( y );
+
+    x = 0;
+    BOOST_CHECK_NO_THROW( insertStmt.exec() );
+    BOOST_CHECK_EQUAL( size, offset );
+
+    x = 1;
+    y.clear();
+    BOOST_CHECK_NO_THROW( insertStmt.exec() );
+
+    rodbc::Statement selectStmt{ conn, "SELECT x, y FROM tbl ORDER BY x" };
+    selectStmt.bindCol( x );
+
+    BOOST_CHECK_NO_THROW( selectStmt.exec() );
+
+    BOOST_CHECK( selectStmt.fetch() );
+    BOOST_CHECK_EQUAL( 0, x );
+
+    std::ostringstream stream;
+    BOOST_CHECK( selectStmt.getData( 2, stream ) );
+
+    const auto value = stream.str();
+    BOOST_REQUIRE_EQUAL( size, value.size() );
+
+    for ( std::size_t index = 0; index < size; ++index )
+    {
+        if ( value[ index ] != static_cast< char >( 'a' + index % 26 ) )
+        {
+            BOOST_ERROR( "Streamed value differs at offset " << index );
+            break;
+        }
+    }
+
+    BOOST_CHECK( selectStmt.fetch() );
+    BOOST_CHECK_EQUAL( 1, x );
+    BOOST_CHECK( !selectStmt.getData( 2, stream ) );
+
+    BOOST_CHECK( !selectStmt.fetch() );
+}
+
+BOOST_AUTO_TEST_CASE( canPollStreamingLongValues )
+{
+    rodbc::Statement{ conn, "DROP TABLE IF EXISTS tbl" }.exec();
+    rodbc::Statement{ conn, "CREATE TEMPORARY TABLE tbl (x TEXT, y TEXT)" }.exec();
+
+    const std::size_t size = 64 * 1024;
+    std::size_t offset = 0;
+
+    rodbc::LongParam x{ [ &offset ]( char* const data, const std::size_t capacity )
+    {
+        const auto chunk = std::min( capacity, size - offset );
+
+        std::fill_n( data, chunk, 'a' );
+
+        offset += chunk;
+
+        return chunk;
+    } };
+
+    rodbc::LongParam y{ rodbc::LongParam::Source{ []( char* const, const std::size_t )
+    {
+        return std::size_t{ 0 };
+    } } };
+
+    rodbc::Statement insertStmt{ conn, "INSERT INTO tbl (x, y) VALUES (?, ?)" };
+    insertStmt.bindParam( x );
+    insertStmt.bindParam( y );
+
+    // Sending the data resumes where it was interrupted instead of waiting for the driver.
+    while ( !insertStmt.pollExec() )
+    {
+    }
+
+    BOOST_CHECK_EQUAL( size, offset );
+
+    rodbc::Statement selectStmt{ conn, "SELECT LENGTH(x), LENGTH(y) FROM tbl" };
+
+    std::int64_t xLength, yLength;
+    selectStmt.bindCol( xLength );
+    selectStmt.bindCol( yLength );
+
+    BOOST_CHECK_NO_THROW( selectStmt.exec() );
+    BOOST_REQUIRE( selectStmt.fetch() );
+
+    BOOST_CHECK_EQUAL( size, xLength );
+    BOOST_CHECK_EQUAL( 0, yLength );
+}
+
+BOOST_AUTO_TEST_CASE( canEnforceDeadline )
+{
+    CreateSimpleTable< int >{ conn };
+
+    rodbc::Statement stmt{ conn, "SELECT col FROM tbl" };
+
+    stmt.setQueryTimeout( std::chrono::seconds{ 10 } );
+    BOOST_CHECK_NO_THROW( stmt.exec() );
+
+    stmt.setDeadline( std::chrono::steady_clock::now() - std::chrono::seconds{ 1 } );
+    BOOST_CHECK_EXCEPTION( stmt.exec(), rodbc::Exception, std::mem_fn( &rodbc::Exception::isTimeout ) );
+
+    stmt.setDeadline( std::chrono::steady_clock::now() + std::chrono::minutes{ 1 } );
+    BOOST_CHECK_NO_THROW( stmt.exec() );
+
+    stmt.setDeadline( std::chrono::steady_clock::time_point::max() );
+    conn.setDeadline( std::chrono::steady_clock::now() - std::chrono::seconds{ 1 } );
+    BOOST_CHECK_EXCEPTION( stmt.exec(), rodbc::Exception, std::mem_fn( &rodbc::Exception::isTimeout ) );
+
+    conn.setDeadline( std::chrono::steady_clock::time_point::max() );
+    BOOST_CHECK_NO_THROW( stmt.exec() );
+}
+
+BOOST_AUTO_TEST_CASE( canReportFailuresBeforeExecutionWithoutThrowing )
+{
+    CreateSimpleTable< int >{ conn };
+
+    {
+        rodbc::Statement stmt{ conn, "SELECT col FROM tbl" };
+
+        stmt.setDeadline( std::chrono::steady_clock::now() - std::chrono::seconds{ 1 } );
+
+        const auto status = stmt.tryExec();
+        BOOST_CHECK( !status.ok() );
+        BOOST_CHECK( status.isTimeout() );
+        BOOST_CHECK( !status.message().empty() );
+    }
+
+    conn.setLazyPrepare( true );
+
+    {
+        rodbc::Statement stmt{ conn, "SELECT col FROM unknown_tbl" };
+
+        BOOST_CHECK( !stmt.tryExec().ok() );
+    }
+
+    conn.setLazyPrepare( false );
+}
+
+BOOST_AUTO_TEST_CASE( canCancelFromAnotherThread )
+{
+    const char* query;
+
+    switch ( conn.dbms() )
+    {
+    case rodbc::DBMS::PostgreSQL:
+        query = "SELECT pg_sleep(60)";
+        break;
+    case rodbc::DBMS::MySQL:
+        query = "SELECT BENCHMARK(10000000000, MD5('rodbc'))";
+        break;
+    case rodbc::DBMS::SQLServer:
+        query = "WAITFOR DELAY '00:01:00'";
+        break;
+    default:
+        query = "WITH RECURSIVE cnt(x) AS (SELECT 1 UNION ALL SELECT x + 1 FROM cnt WHERE x < 10000000000) SELECT MAX(x) FROM cnt";
+        break;
+    }
+
+    rodbc::Statement stmt{ conn, query };
+
+    const auto handle = stmt.cancelHandle();
+    std::atomic< bool > done{ false };
+
+    auto canceller = std::async( std::launch::async, [ handle, &done ]()
+    {
+        // Cancelling a statement which is not executing yet has no effect, hence keep trying.
+        while ( !done )
+        {
+            std::this_thread::sleep_for( std::chrono::milliseconds{ 100 } );
+
+            handle.cancel();
+        }
+    } );
+
+    BOOST_CHECK_EXCEPTION( stmt.exec(), rodbc::Exception, std::mem_fn( &rodbc::Exception::isCancelled ) );
+
+    done = true;
+    BOOST_CHECK_NO_THROW( canceller.get() );
+}
+
+BOOST_AUTO_TEST_CASE( cannotCancelRecycledStatement )
+{
+    CreateSimpleTable< int >{ conn };
+
+    int col;
+
+    rodbc::Statement insertStmt{ conn, "INSERT INTO tbl (col) VALUES (?)" };
+    insertStmt.bindParam( col );
+
+    for ( col = 0; col < 16; ++col )
+    {
+        BOOST_CHECK_NO_THROW( insertStmt.exec() );
+    }
+
+    const auto handle = rodbc::Statement{ conn, "SELECT col FROM tbl" }.cancelHandle();
+
+    // The new statement is likely to reuse the handle released by the one above.
+    rodbc::Statement selectStmt{ conn, "SELECT col FROM tbl ORDER BY col" };
+    BOOST_CHECK_NO_THROW( selectStmt.exec() );
+
+    BOOST_CHECK_NO_THROW( handle.cancel() );
+
+    selectStmt.bindCol( col );
+
+    for ( int index = 0; index < 16; ++index )
+    {
+        BOOST_REQUIRE( selectStmt.fetch() );
+        BOOST_CHECK_EQUAL( index, col );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( canDeferPreparation )
+{
+    CreateSimpleTable< int >{ conn };
+
+    conn.setLazyPrepare( true );
+
+    {
+        rodbc::Statement unusedStmt{ conn, "SELECT col FROM unknown_tbl" };
+
+        int x;
+        rodbc::Statement stmt{ conn, "SELECT col FROM tbl" };
+        stmt.bindCol( x );
+
+        BOOST_CHECK_EQUAL( 2, conn.prepareStatistics().deferred );
+        BOOST_CHECK_EQUAL( 0, conn.prepareStatistics().prepared );
+
+        BOOST_CHECK_NO_THROW( stmt.exec() );
+        BOOST_CHECK( !stmt.fetch() );
+
+        BOOST_CHECK_EQUAL( 1, conn.prepareStatistics().prepared );
+    }
+
+    BOOST_CHECK_EQUAL( 1, conn.prepareStatistics().discarded );
+
+    conn.setLazyPrepare( false );
+
+    BOOST_CHECK_THROW( ( rodbc::Statement{ conn, "SELECT col FROM unknown_tbl" } ), rodbc::Exception );
+}
+
+BOOST_AUTO_TEST_CASE( canOutliveConnection )
+{
+    std::unique_ptr< rodbc::Connection > otherConn{ new rodbc::Connection{ env, RODBC_TEST_CONN_STR } };
+    otherConn->setLazyPrepare( true );
+
+    std::unique_ptr< rodbc::Statement > stmt{ new rodbc::Statement{ *otherConn, "SELECT 1" } };
+
+    std::unique_ptr< rodbc::Connection > movedConn{ new rodbc::Connection{ std::move( *otherConn ) } };
+    otherConn.reset();
+
+    BOOST_CHECK_EQUAL( 1, movedConn->prepareStatistics().deferred );
+
+    stmt.reset( new rodbc::Statement{ *movedConn, "SELECT 1" } );
+
+    BOOST_CHECK_EQUAL( 1, movedConn->prepareStatistics().discarded );
+
+    movedConn.reset();
+
+    BOOST_CHECK_NO_THROW( stmt.reset() );
+}
+
+BOOST_AUTO_TEST_CASE( canExecuteAfterConnectionWasMoved )
+{
+    std::unique_ptr< rodbc::Connection > otherConn{ new rodbc::Connection{ env, RODBC_TEST_CONN_STR } };
+
+    rodbc::Statement stmt{ *otherConn, "SELECT 1" };
+
+    rodbc::Connection movedConn{ std::move( *otherConn ) };
+    otherConn.reset();
+
+    BOOST_CHECK_NO_THROW( stmt.exec() );
+
+    movedConn.setDeadline( std::chrono::steady_clock::now() - std::chrono::seconds{ 1 } );
+    BOOST_CHECK_EXCEPTION( stmt.exec(), rodbc::Exception, std::mem_fn( &rodbc::Exception::isTimeout ) );
+
+    movedConn.setDeadline( std::chrono::steady_clock::time_point::max() );
+    BOOST_CHECK_NO_THROW( stmt.exec() );
+}
+
+BOOST_AUTO_TEST_CASE( canMoveStatementWithDeferredColumns )
+{
+    CreateSimpleTable< int >{ conn };
+
+    rodbc::Statement{ conn, "INSERT INTO tbl (col) VALUES (1), (2)" }.exec();
+
+    rodbc::Deferred< int > col;
+
+    std::unique_ptr< rodbc::Statement > stmt{ new rodbc::Statement{ conn, "SELECT col FROM tbl ORDER BY col" } };
+    stmt->bindCol( col );
+    stmt->exec();
+
+    BOOST_REQUIRE( stmt->fetch() );
+
+    rodbc::Statement movedStmt{ std::move( *stmt ) };
+    stmt.reset();
+
+    BOOST_CHECK_EQUAL( 1, *col );
+
+    col = rodbc::Deferred< int >{};
+
+    BOOST_REQUIRE( movedStmt.fetch() );
+    BOOST_CHECK_EQUAL( 2, *col );
+
+    movedStmt = rodbc::Statement{ conn, "SELECT col FROM tbl" };
+
+    BOOST_CHECK_THROW( col.get(), std::invalid_argument );
+}
+
+BOOST_AUTO_TEST_CASE( canRecycleHandles )
+{
+    CreateSimpleTable< int >{ conn };
+
+    const auto recycledHandles = conn.recycledHandles();
+    BOOST_CHECK( recycledHandles > 0 );
+
+    {
+        int x = 42;
+        rodbc::Statement stmt{ conn, "INSERT INTO tbl (col) VALUES (?)" };
+        stmt.bindParam( x );
+        stmt.exec();
+
+        BOOST_CHECK_EQUAL( recycledHandles - 1, conn.recycledHandles() );
+    }
+
+    BOOST_CHECK_EQUAL( recycledHandles, conn.recycledHandles() );
+
+    {
+        int x = 0;
+        rodbc::Statement stmt{ conn, "SELECT col FROM tbl" };
+        stmt.bindCol( x );
+        stmt.exec();
+
+        BOOST_REQUIRE( stmt.fetch() );
+        BOOST_CHECK_EQUAL( 42, x );
+        BOOST_CHECK( !stmt.fetch() );
+    }
+
+    {
+        rodbc::Statement stmt{ conn, "SELECT col FROM tbl", rodbc::CursorType::Static };
+    }
+
+    BOOST_CHECK_EQUAL( recycledHandles - 1, conn.recycledHandles() );
+
+    conn.setMaxRecycledHandles( 0 );
+
+    BOOST_CHECK_EQUAL( 0, conn.recycledHandles() );
+}
+
+BOOST_AUTO_TEST_CASE( canApplyBindingPlan )
+{
+    CreateSimpleTable< int >{ conn };
+
+    struct Row
+    {
+        int col;
+    };
+
+    rodbc::BindingPlan plan;
+
+    {
+        Row row;
+
+        rodbc::BindingRecorder recorder{ plan, &row, sizeof ( row ) };
+        recorder.bindParam( row.col );
+        recorder.bindCol( row.col );
+
+        int other;
+        BOOST_CHECK_THROW( recorder.bindCol( other ), std::invalid_argument );
+    }
+
+    BOOST_CHECK( !plan.empty() );
+
+    Row rows[ 2 ] = { { 1 }, { 2 } };
+
+    rodbc::Statement insertStmt{ conn, "INSERT INTO tbl (col) VALUES (?)" };
+    insertStmt.bindParams( plan, &rows[ 0 ] );
+    BOOST_CHECK_NO_THROW( insertStmt.exec() );
+    insertStmt.bindParams( plan, &rows[ 1 ] );
+    BOOST_CHECK_NO_THROW( insertStmt.exec() );
+
+    Row result{ 0 };
+
+    rodbc::Statement selectStmt{ conn, "SELECT col FROM tbl ORDER BY col" };
+    selectStmt.bindCols( plan, &result );
+    BOOST_CHECK_NO_THROW( selectStmt.exec() );
+
+    BOOST_CHECK( selectStmt.fetch() );
+    BOOST_CHECK_EQUAL( 1, result.col );
+    BOOST_CHECK( selectStmt.fetch() );
+    BOOST_CHECK_EQUAL( 2, result.col );
+    BOOST_CHECK( !selectStmt.fetch() );
+}
+
+BOOST_AUTO_TEST_CASE( canDetectBindMismatches )
+{
+    CreateSimpleTable< std::int64_t >{ conn };
+
+    conn.setBindValidation( rodbc::BindValidation::Report );
+
+    {
+        std::int64_t col;
+
+        rodbc::Statement stmt{ conn, "SELECT col FROM tbl" };
+        stmt.bindCol( col );
+    }
+
+    BOOST_CHECK( conn.bindMismatches().empty() );
+
+    for ( int index = 0; index < 2; ++index )
+    {
+        std::int32_t col;
+
+        rodbc::Statement stmt{ conn, "SELECT col FROM tbl" };
+        stmt.bindCol( col );
+        stmt.rebindCols().bindCol( col );
+    }
+
+    BOOST_REQUIRE_EQUAL( 1, conn.bindMismatches().size() );
+
+    const auto& mismatch = conn.bindMismatches().front();
+    BOOST_CHECK_EQUAL( "SELECT col FROM tbl", mismatch.stmt );
+    BOOST_CHECK( !mismatch.param );
+    BOOST_CHECK_EQUAL( 1, mismatch.number );
+    BOOST_CHECK( mismatch.lossy );
+
+    conn.clearBindMismatches();
+    conn.setBindValidation( rodbc::BindValidation::Reject );
+
+    {
+        std::int32_t col;
+
+        rodbc::Statement stmt{ conn, "SELECT col FROM tbl" };
+        BOOST_CHECK_THROW( stmt.bindCol( col ), rodbc::Exception );
+    }
+
+    BOOST_CHECK( conn.bindMismatches().empty() );
+
+    conn.setBindValidation( rodbc::BindValidation::Off );
+}
+
+BOOST_AUTO_TEST_CASE( canDetectParamMismatches )
+{
+    CreateSimpleTable< std::int64_t >{ conn };
+
+    conn.setBindValidation( rodbc::BindValidation::Reject );
+
+    {
+        const std::int64_t param = 1;
+
+        rodbc::Statement stmt{ conn, "SELECT col FROM tbl WHERE col = ?" };
+        BOOST_CHECK_NO_THROW( stmt.bindParam( param ) );
+    }
+
+    conn.setBindValidation( rodbc::BindValidation::Report );
+
+    {
+        const std::uint32_t param = 1;
+
+        rodbc::Statement stmt{ conn, "SELECT col FROM tbl WHERE col = ?" };
+        stmt.bindParam( param );
+    }
+
+    switch ( conn.dbms() )
+    {
+    case rodbc::DBMS::PostgreSQL:
+    case rodbc::DBMS::SQLServer:
+    {
+        BOOST_REQUIRE_EQUAL( 1, conn.bindMismatches().size() );
+
+        const auto& mismatch = conn.bindMismatches().front();
+        BOOST_CHECK( mismatch.param );
+        BOOST_CHECK_EQUAL( 1, mismatch.number );
+        BOOST_CHECK( !mismatch.lossy );
+        break;
+    }
+    default:
+        BOOST_CHECK( conn.bindMismatches().empty() );
+        break;
+    }
+
+    conn.clearBindMismatches();
+    conn.setBindValidation( rodbc::BindValidation::Off );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
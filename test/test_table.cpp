@@ -192,4 +192,212 @@ BOOST_AUTO_TEST_CASE( canUseSubtypeForExtension )
     }
 }
 
+BOOST_AUTO_TEST_CASE( canIgnoreDuplicateRowsWithoutExceptions )
+{
+    rodbc::Table< std::tuple< int, rodbc::String< 32 > >, 0 > table{
+        conn, "tbl", { "pk", "col" }
+    };
+
+    table.create( rodbc::DROP_TABLE_IF_EXISTS | rodbc::TEMPORARY_TABLE );
+
+    BOOST_CHECK( table.tryInsert( std::make_tuple( 0, rodbc::String< 32 >{ "foo" } ) ).ok() );
+
+    const auto status = table.tryInsert( std::make_tuple( 0, rodbc::String< 32 >{ "bar" } ) );
+
+    BOOST_CHECK( !status.ok() );
+    BOOST_CHECK( status.isConstraintViolation() );
+    BOOST_CHECK( !status.message().empty() );
+
+    BOOST_CHECK_EQUAL( std::string{ "foo" }, std::get< 1 >( *table.select( 0 ) ).str() );
+
+    BOOST_CHECK_EXCEPTION( table.insert( std::make_tuple( 0, rodbc::String< 32 >{ "bar" } ) ), rodbc::Exception, std::mem_fn( &rodbc::Exception::isConstraintViolation ) );
+}
+
+BOOST_AUTO_TEST_CASE( canInsertRowSets )
+{
+    for ( const auto strategy : { rodbc::InsertStrategy::ParamArrays, rodbc::InsertStrategy::BulkOperations } )
+    {
+        if ( strategy == rodbc::InsertStrategy::BulkOperations && conn.bulkOperationsCursor() == rodbc::CursorType::ForwardOnly )
+        {
+            BOOST_TEST_MESSAGE( "Driver does not support bulk additions." );
+
+            continue;
+        }
+
+        conn.setInsertStrategy( strategy );
+
+        rodbc::Table< std::tuple< int, rodbc::String< 32 > >, 0 > table{
+            conn, "tbl", { "pk", "col" }
+        };
+
+        table.create( rodbc::DROP_TABLE_IF_EXISTS | rodbc::TEMPORARY_TABLE );
+
+        std::vector< std::tuple< int, rodbc::String< 32 > > > rows;
+
+        for ( int index = 0; index < 128; ++index )
+        {
+            rows.emplace_back( index, rodbc::String< 32 >{ std::to_string( index ) } );
+        }
+
+        BOOST_CHECK_NO_THROW( table.insert( rows ) );
+
+        std::vector< std::tuple< int, rodbc::String< 32 > > > moreRows;
+
+        for ( int index = 128; index < 160; ++index )
+        {
+            moreRows.emplace_back( index, rodbc::String< 32 >{ std::to_string( index ) } );
+        }
+
+        BOOST_CHECK_NO_THROW( table.insert( moreRows ) );
+
+        const auto results = collectResults( table.selectAll() );
+
+        BOOST_REQUIRE_EQUAL( 160, results.size() );
+
+        for ( int index = 0; index < 160; ++index )
+        {
+            BOOST_CHECK_EQUAL( std::to_string( index ), std::get< 1 >( *table.select( index ) ).str() );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( canProbeInsertStrategy )
+{
+    rodbc::Connection otherConn{ env, RODBC_TEST_CONN_STR };
+
+    const auto strategy = otherConn.insertStrategy();
+
+    if ( strategy == rodbc::InsertStrategy::BulkOperations )
+    {
+        BOOST_CHECK( otherConn.bulkOperationsCursor() != rodbc::CursorType::ForwardOnly );
+    }
+
+    BOOST_CHECK( strategy == otherConn.insertStrategy() );
+
+    CreateSimpleTable< int >{ otherConn };
+
+    const std::string columnNames[] = { "col" };
+
+    rodbc::BulkInsertStatement< std::tuple< int > > stmt{ otherConn, "tbl", columnNames };
+
+    BOOST_CHECK( strategy == stmt.strategy() );
+
+    otherConn.setInsertStrategy( rodbc::InsertStrategy::ParamArrays );
+
+    BOOST_CHECK( rodbc::InsertStrategy::ParamArrays == otherConn.insertStrategy() );
+
+    const std::vector< std::tuple< int > > rows{ std::make_tuple( 1 ), std::make_tuple( 2 ) };
+
+    BOOST_CHECK_NO_THROW( stmt.exec( rows ) );
+    BOOST_CHECK( stmt.rowCount() == 2 || stmt.rowCount() == -1 );
+}
+
+BOOST_AUTO_TEST_CASE( canCountAffectedRows )
+{
+    rodbc::Table< std::tuple< int, rodbc::String< 32 > >, 0 > table{
+        conn, "tbl", { "pk", "col" }
+    };
+
+    table.create( rodbc::DROP_TABLE_IF_EXISTS | rodbc::TEMPORARY_TABLE );
+
+    std::vector< std::tuple< int, rodbc::String< 32 > > > rows;
+
+    for ( int index = 0; index < 16; ++index )
+    {
+        rows.emplace_back( index, rodbc::String< 32 >{ std::to_string( index % 2 ) } );
+    }
+
+    BOOST_CHECK_EQUAL( 16, table.insert( rows ) );
+
+    BOOST_CHECK_EQUAL( 1, table.insert( std::make_tuple( 16, rodbc::String< 32 >{ "0" } ) ) );
+    BOOST_CHECK_EQUAL( 1, table.insertAt( std::make_tuple( 17, rodbc::String< 32 >{} ), rodbc::IndexSequence< 0 >{} ) );
+
+    BOOST_CHECK_EQUAL( 1, table.update( std::make_tuple( 0, rodbc::String< 32 >{ "2" } ) ) );
+    BOOST_CHECK_EQUAL( 0, table.update( std::make_tuple( 18, rodbc::String< 32 >{ "2" } ) ) );
+
+    BOOST_CHECK_EQUAL( 8, table.deleteBy< 1 >( rodbc::String< 32 >{ "1" } ) );
+    BOOST_CHECK_EQUAL( 10, table.deleteAll() );
+}
+
+BOOST_AUTO_TEST_CASE( canReturnGeneratedKeys )
+{
+    const char* keyDefinition;
+
+    switch ( conn.dbms() )
+    {
+    case rodbc::DBMS::SQLite:
+        keyDefinition = "INTEGER PRIMARY KEY";
+        break;
+    case rodbc::DBMS::PostgreSQL:
+        keyDefinition = "BIGSERIAL PRIMARY KEY";
+        break;
+    case rodbc::DBMS::MySQL:
+        keyDefinition = "BIGINT AUTO_INCREMENT PRIMARY KEY";
+        break;
+    default:
+        BOOST_TEST_MESSAGE( "Auto-incremented keys are not defined for this DBMS." );
+        return;
+    }
+
+    rodbc::Statement{ conn, "DROP TABLE IF EXISTS tbl" }.exec();
+    rodbc::Statement{ conn, ( std::string{ "CREATE TEMPORARY TABLE tbl (pk " } + keyDefinition + ", col INT NOT NULL)" ).c_str() }.exec();
+
+    rodbc::Table< std::tuple< std::int64_t, int >, 0 > table{
+        conn, "tbl", { "pk", "col" }
+    };
+
+    std::vector< std::tuple< std::int64_t, int > > rows;
+
+    for ( int index = 0; index < 1500; ++index )
+    {
+        rows.emplace_back( 0, index );
+    }
+
+    std::vector< std::int64_t > keys;
+    table.insertReturningAt< 0 >( rows, keys, rodbc::IndexSequence< 1 >{} );
+
+    BOOST_REQUIRE_EQUAL( rows.size(), keys.size() );
+
+    for ( int index = 0; index < 1500; ++index )
+    {
+        const auto row = table.select( keys[ index ] );
+
+        BOOST_REQUIRE( row.is_initialized() );
+        BOOST_CHECK_EQUAL( index, std::get< 1 >( *row ) );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( canReturnKeysDistinctFromRowIds )
+{
+    if ( conn.dbms() != rodbc::DBMS::SQLite )
+    {
+        BOOST_TEST_MESSAGE( "Row identifiers are specific to SQLite." );
+        return;
+    }
+
+    rodbc::Statement{ conn, "DROP TABLE IF EXISTS tbl" }.exec();
+    rodbc::Statement{ conn, "CREATE TEMPORARY TABLE tbl (pk BIGINT PRIMARY KEY, col INT NOT NULL)" }.exec();
+
+    rodbc::Table< std::tuple< std::int64_t, int >, 0 > table{
+        conn, "tbl", { "pk", "col" }
+    };
+
+    std::vector< std::tuple< std::int64_t, int > > rows;
+
+    for ( int index = 0; index < 1500; ++index )
+    {
+        rows.emplace_back( 1000 + 7 * index, index );
+    }
+
+    std::vector< std::int64_t > keys;
+    table.insertReturningAt< 0 >( rows, keys, rodbc::IndexSequence< 0, 1 >{} );
+
+    BOOST_REQUIRE_EQUAL( rows.size(), keys.size() );
+
+    for ( int index = 0; index < 1500; ++index )
+    {
+        BOOST_CHECK_EQUAL( 1000 + 7 * index, keys[ index ] );
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -24,6 +24,9 @@ along with rodbc.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
+#include <chrono>
+
 namespace
 {
 
@@ -89,6 +92,25 @@ void selectIndices( rodbc::TypedStatement< std::tuple<>, std::vector< std::tuple
     BOOST_CHECK( !stmt.fetch() );
 }
 
+void selectIndices( rodbc::TypedStatement< std::tuple<>, rodbc::ColumnArrays< std::tuple< int > > >& stmt, int size )
+{
+    BOOST_CHECK_NO_THROW( stmt.exec() );
+
+    for( int index = 0; index < size; )
+    {
+        BOOST_CHECK( stmt.fetch() );
+
+        const auto& cols = stmt.cols().column< 0 >();
+
+        for ( std::size_t row = 0; row < cols.size(); ++row )
+        {
+            BOOST_CHECK_EQUAL( index++, cols.data()[ row ] );
+        }
+    }
+
+    BOOST_CHECK( !stmt.fetch() );
+}
+
 }
 
 BOOST_FIXTURE_TEST_SUITE( typedStmt, Fixture )
@@ -111,6 +133,159 @@ BOOST_AUTO_TEST_CASE( canRoundtripParamToCol )
     BOOST_CHECK( !stmt.fetch() );
 }
 
+BOOST_AUTO_TEST_CASE( canShareDescriptors )
+{
+    CreateSimpleTable< int >{ conn };
+
+    rodbc::Statement insertStmt{
+        conn, "INSERT INTO tbl (col) VALUES (?)"
+    };
+
+    insertIndices( insertStmt, 16 );
+
+    conn.setShareDescriptors( true );
+
+    rodbc::TypedStatement< std::tuple<>, std::tuple< int > > ascendingStmt{
+        conn, "SELECT col FROM tbl ORDER BY col ASC"
+    };
+
+    rodbc::TypedStatement< std::tuple<>, std::tuple< int > > descendingStmt{
+        conn, "SELECT col FROM tbl ORDER BY col DESC"
+    };
+
+    BOOST_CHECK_NO_THROW( ascendingStmt.exec() );
+    BOOST_CHECK_NO_THROW( descendingStmt.exec() );
+
+    for ( int index = 0; index < 16; ++index )
+    {
+        BOOST_REQUIRE( ascendingStmt.fetch() );
+        BOOST_REQUIRE( descendingStmt.fetch() );
+
+        BOOST_CHECK_EQUAL( index, std::get< 0 >( ascendingStmt.cols() ) );
+        BOOST_CHECK_EQUAL( 15 - index, std::get< 0 >( descendingStmt.cols() ) );
+    }
+
+    BOOST_CHECK( !ascendingStmt.fetch() );
+    BOOST_CHECK( !descendingStmt.fetch() );
+}
+
+BOOST_AUTO_TEST_CASE( canPollSharingDescriptors )
+{
+    CreateSimpleTable< int >{ conn };
+
+    rodbc::Statement insertStmt{
+        conn, "INSERT INTO tbl (col) VALUES (?)"
+    };
+
+    insertIndices( insertStmt, 16 );
+
+    conn.setShareDescriptors( true );
+
+    rodbc::TypedStatement< std::tuple<>, std::tuple< int > > ascendingStmt{
+        conn, "SELECT col FROM tbl ORDER BY col ASC"
+    };
+
+    rodbc::TypedStatement< std::tuple<>, std::tuple< int > > descendingStmt{
+        conn, "SELECT col FROM tbl ORDER BY col DESC"
+    };
+
+    BOOST_CHECK_NO_THROW( ascendingStmt.exec() );
+    BOOST_CHECK_NO_THROW( descendingStmt.exec() );
+
+    for ( int index = 0; index < 16; ++index )
+    {
+        bool ascending = false;
+
+        while ( !ascendingStmt.pollFetch( ascending ) )
+        {
+        }
+
+        BOOST_REQUIRE( ascending );
+        BOOST_REQUIRE( descendingStmt.fetch() );
+
+        BOOST_CHECK_EQUAL( index, std::get< 0 >( ascendingStmt.cols() ) );
+        BOOST_CHECK_EQUAL( 15 - index, std::get< 0 >( descendingStmt.cols() ) );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( canValidateSharedDescriptors )
+{
+    CreateSimpleTable< std::int64_t >{ conn };
+
+    conn.setShareDescriptors( true );
+    conn.setBindValidation( rodbc::BindValidation::Report );
+
+    rodbc::TypedStatement< std::tuple<>, std::tuple< std::int32_t > > someStmt{
+        conn, "SELECT col FROM tbl"
+    };
+
+    rodbc::TypedStatement< std::tuple<>, std::tuple< std::int32_t > > otherStmt{
+        conn, "SELECT col FROM tbl WHERE col > 0"
+    };
+
+    BOOST_REQUIRE_EQUAL( 2, conn.bindMismatches().size() );
+
+    for ( const auto& mismatch : conn.bindMismatches() )
+    {
+        BOOST_CHECK( !mismatch.param );
+        BOOST_CHECK_EQUAL( 1, mismatch.number );
+        BOOST_CHECK( mismatch.lossy );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( canDeferColumns )
+{
+    rodbc::CreateTable< std::tuple< int, rodbc::String< 32 > > >{
+        conn, "tbl", { "x", "y" },
+        rodbc::DROP_TABLE_IF_EXISTS | rodbc::TEMPORARY_TABLE
+    };
+
+    {
+        rodbc::TypedStatement< std::vector< std::tuple< int, rodbc::String< 32 > > >, std::tuple<> > insertStmt{
+            conn, "INSERT INTO tbl (x, y) VALUES (?, ?)"
+        };
+
+        for ( int index = 0; index < 16; ++index )
+        {
+            insertStmt.params().emplace_back( index, rodbc::String< 32 >{ std::to_string( index ) } );
+        }
+
+        insertStmt.exec();
+    }
+
+    rodbc::TypedStatement< std::tuple<>, std::tuple< int, rodbc::Deferred< rodbc::String< 32 > > > > selectStmt{
+        conn, "SELECT x, y FROM tbl ORDER BY x"
+    };
+
+    BOOST_CHECK_NO_THROW( selectStmt.exec() );
+
+    rodbc::Deferred< rodbc::String< 32 > > copy;
+    BOOST_CHECK_THROW( copy.get(), std::invalid_argument );
+
+    for ( int index = 0; index < 16; ++index )
+    {
+        BOOST_REQUIRE( selectStmt.fetch() );
+        BOOST_CHECK_EQUAL( index, std::get< 0 >( selectStmt.cols() ) );
+
+        if ( index % 4 == 0 )
+        {
+            const auto& y = std::get< 1 >( selectStmt.cols() );
+
+            BOOST_CHECK_EQUAL( std::to_string( index ), y->str() );
+            BOOST_CHECK_EQUAL( std::to_string( index ), y.get().str() );
+        }
+
+        if ( index == 5 )
+        {
+            copy = std::get< 1 >( selectStmt.cols() );
+        }
+    }
+
+    BOOST_CHECK( !selectStmt.fetch() );
+
+    BOOST_CHECK_EQUAL( "5", copy->str() );
+}
+
 BOOST_AUTO_TEST_CASE( canRebindParameterSet )
 {
     CreateSimpleTable< int >{ conn };
@@ -149,6 +324,42 @@ BOOST_AUTO_TEST_CASE( canRebindParameterSet )
     BOOST_CHECK_NO_THROW( deleteStmt.exec() );
 }
 
+BOOST_AUTO_TEST_CASE( canAlternateBetweenParameterBuffers )
+{
+    CreateSimpleTable< int >{ conn };
+
+    rodbc::TypedStatement< std::vector< std::tuple< int > >, std::tuple<> > insertStmt{
+        conn, "INSERT INTO tbl (col) VALUES (?)"
+    };
+
+    rodbc::Statement selectStmt{
+        conn, "SELECT col FROM tbl ORDER BY col"
+    };
+
+    std::vector< std::tuple< int > > someParams, otherParams;
+
+    for ( int index = 0; index < 32; ++index )
+    {
+        someParams.emplace_back( index );
+        otherParams.emplace_back( 32 + index );
+    }
+
+    // Each switch re-points the bound parameters regardless of where the other buffer is located.
+    BOOST_CHECK_NO_THROW( insertStmt.exec( someParams ) );
+    BOOST_CHECK_NO_THROW( insertStmt.exec( otherParams ) );
+
+    selectIndices( selectStmt, 64 );
+
+    for ( auto& params : someParams )
+    {
+        std::get< 0 >( params ) += 64;
+    }
+
+    BOOST_CHECK_NO_THROW( insertStmt.exec( someParams ) );
+
+    selectIndices( selectStmt, 96 );
+}
+
 BOOST_AUTO_TEST_CASE( canRebindRowSet )
 {
     CreateSimpleTable< int >{ conn };
@@ -177,4 +388,360 @@ BOOST_AUTO_TEST_CASE( canRebindRowSet )
     selectIndices( selectStmt, 256 );
 }
 
+BOOST_AUTO_TEST_CASE( canReuseFetchBuffer )
+{
+    CreateSimpleTable< int >{ conn };
+
+    rodbc::Statement insertStmt{
+        conn, "INSERT INTO tbl (col) VALUES (?)"
+    };
+
+    insertIndices( insertStmt, 100 );
+
+    rodbc::TypedStatement< std::tuple<>, std::vector< std::tuple< int > > > selectStmt{
+        conn, "SELECT col FROM tbl ORDER BY col", 64
+    };
+
+    const auto* const data = selectStmt.cols().data();
+
+    for ( int execution = 0; execution < 2; ++execution )
+    {
+        BOOST_CHECK_NO_THROW( selectStmt.exec() );
+        BOOST_CHECK( selectStmt.cols().empty() );
+
+        BOOST_CHECK( selectStmt.fetch() );
+        BOOST_CHECK_EQUAL( 64, selectStmt.cols().size() );
+
+        BOOST_CHECK( selectStmt.fetch() );
+        BOOST_CHECK_EQUAL( 36, selectStmt.cols().size() );
+        BOOST_CHECK_EQUAL( 99, std::get< 0 >( selectStmt.cols().back() ) );
+
+        BOOST_CHECK( !selectStmt.fetch() );
+        BOOST_CHECK_EQUAL( data, selectStmt.cols().data() );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( canAdaptFetchSize )
+{
+    CreateSimpleTable< int >{ conn };
+
+    rodbc::Statement insertStmt{
+        conn, "INSERT INTO tbl (col) VALUES (?)"
+    };
+
+    insertIndices( insertStmt, 1024 );
+
+    rodbc::TypedStatement< std::tuple< int >, std::vector< std::tuple< int > > > selectStmt{
+        conn, "SELECT col FROM tbl WHERE col < ? ORDER BY col", 1
+    };
+
+    selectStmt.setAdaptiveFetchSize( 256 * sizeof ( std::tuple< int > ) );
+
+    std::vector< int > sizes{ 1024, 1024 };
+    sizes.resize( 16, 3 );
+
+    std::size_t maxFetchSize = 0;
+
+    for ( const auto size : sizes )
+    {
+        std::get< 0 >( selectStmt.params() ) = size;
+
+        BOOST_CHECK_NO_THROW( selectStmt.exec() );
+
+        int index = 0;
+
+        while ( selectStmt.fetch() )
+        {
+            BOOST_CHECK_LE( selectStmt.fetchSize(), 256 );
+
+            maxFetchSize = std::max( maxFetchSize, selectStmt.fetchSize() );
+
+            for ( const auto& cols : selectStmt.cols() )
+            {
+                BOOST_CHECK_EQUAL( index++, std::get< 0 >( cols ) );
+            }
+        }
+
+        BOOST_CHECK_EQUAL( size, index );
+    }
+
+    BOOST_CHECK_EQUAL( 256, maxFetchSize );
+    BOOST_CHECK_LT( selectStmt.fetchSize(), 16 );
+}
+
+BOOST_AUTO_TEST_CASE( canGrowFetchSizeWithinCap )
+{
+    using namespace std::chrono;
+
+    rodbc::detail::AdaptiveFetchSize adaptiveFetchSize;
+    adaptiveFetchSize.setMaxRows( 100 );
+
+    adaptiveFetchSize.exec();
+    BOOST_CHECK_EQUAL( 16, adaptiveFetchSize.fetchSize() );
+
+    // Latency independent of the fetch size, i.e. throughput proportional to it.
+    for ( std::size_t fetchSize = 16; fetchSize < 100; fetchSize = adaptiveFetchSize.fetchSize() )
+    {
+        for ( int sample = 0; sample < 3; ++sample )
+        {
+            BOOST_CHECK_EQUAL( fetchSize, adaptiveFetchSize.fetchSize() );
+
+            adaptiveFetchSize.fetched( fetchSize, fetchSize, milliseconds( 1 ) );
+        }
+
+        BOOST_CHECK_LE( adaptiveFetchSize.fetchSize(), 100 );
+        BOOST_CHECK_GT( adaptiveFetchSize.fetchSize(), fetchSize );
+    }
+
+    BOOST_CHECK_EQUAL( 100, adaptiveFetchSize.fetchSize() );
+
+    adaptiveFetchSize.fetched( 100, 100, milliseconds( 1 ) );
+    BOOST_CHECK_EQUAL( 100, adaptiveFetchSize.fetchSize() );
+
+    // A partial row set of five rows sizes the next execution to fit the expected rows.
+    rodbc::detail::AdaptiveFetchSize otherAdaptiveFetchSize;
+    otherAdaptiveFetchSize.setMaxRows( 100 );
+
+    otherAdaptiveFetchSize.exec();
+    otherAdaptiveFetchSize.fetched( 5, 16, milliseconds( 1 ) );
+
+    otherAdaptiveFetchSize.exec();
+    BOOST_CHECK_EQUAL( 8, otherAdaptiveFetchSize.fetchSize() );
+}
+
+BOOST_AUTO_TEST_CASE( canIgnoreNoisyLatency )
+{
+    using namespace std::chrono;
+
+    rodbc::detail::AdaptiveFetchSize adaptiveFetchSize;
+    adaptiveFetchSize.setMaxRows( 1024 );
+
+    adaptiveFetchSize.exec();
+
+    for ( int sample = 0; sample < 3; ++sample )
+    {
+        adaptiveFetchSize.fetched( 16, 16, milliseconds( 1 ) );
+    }
+
+    BOOST_REQUIRE_EQUAL( 32, adaptiveFetchSize.fetchSize() );
+
+    // A single slow fetch does not stop growth if the smoothed throughput still improves.
+    adaptiveFetchSize.fetched( 32, 32, milliseconds( 10 ) );
+    adaptiveFetchSize.fetched( 32, 32, milliseconds( 1 ) );
+    adaptiveFetchSize.fetched( 32, 32, milliseconds( 1 ) );
+
+    BOOST_REQUIRE_EQUAL( 64, adaptiveFetchSize.fetchSize() );
+
+    // Throughput which does not improve with the fetch size stops growth.
+    for ( int sample = 0; sample < 3; ++sample )
+    {
+        adaptiveFetchSize.fetched( 64, 64, milliseconds( 4 ) );
+    }
+
+    BOOST_CHECK_EQUAL( 64, adaptiveFetchSize.fetchSize() );
+
+    adaptiveFetchSize.fetched( 64, 64, microseconds( 1 ) );
+
+    BOOST_CHECK_EQUAL( 64, adaptiveFetchSize.fetchSize() );
+}
+
+BOOST_AUTO_TEST_CASE( canScrollThroughPages )
+{
+    CreateSimpleTable< int >{ conn };
+
+    rodbc::Statement insertStmt{
+        conn, "INSERT INTO tbl (col) VALUES (?)"
+    };
+
+    insertIndices( insertStmt, 100 );
+
+    rodbc::TypedStatement< std::tuple<>, std::vector< std::tuple< int > > > selectStmt{
+        conn, "SELECT col FROM tbl ORDER BY col", 16, rodbc::CursorType::Static
+    };
+
+    BOOST_CHECK_NO_THROW( selectStmt.exec() );
+
+    BOOST_REQUIRE( selectStmt.fetchScroll( rodbc::FetchOrientation::Absolute, 3 * 16 + 1 ) );
+    BOOST_CHECK_EQUAL( 16, selectStmt.cols().size() );
+    BOOST_CHECK_EQUAL( 3 * 16, std::get< 0 >( selectStmt.cols().front() ) );
+
+    BOOST_REQUIRE( selectStmt.fetchScroll( rodbc::FetchOrientation::Last ) );
+    BOOST_CHECK_EQUAL( 16, selectStmt.cols().size() );
+    BOOST_CHECK_EQUAL( 99, std::get< 0 >( selectStmt.cols().back() ) );
+
+    BOOST_REQUIRE( selectStmt.fetchScroll( rodbc::FetchOrientation::Absolute, 6 * 16 + 1 ) );
+    BOOST_CHECK_EQUAL( 100 - 6 * 16, selectStmt.cols().size() );
+
+    BOOST_REQUIRE( selectStmt.fetchScroll( rodbc::FetchOrientation::First ) );
+    BOOST_CHECK_EQUAL( 16, selectStmt.cols().size() );
+    BOOST_CHECK_EQUAL( 0, std::get< 0 >( selectStmt.cols().front() ) );
+
+    BOOST_REQUIRE( selectStmt.fetchScroll( rodbc::FetchOrientation::Relative, 16 ) );
+    BOOST_CHECK_EQUAL( 16, std::get< 0 >( selectStmt.cols().front() ) );
+
+    BOOST_CHECK( !selectStmt.fetchScroll( rodbc::FetchOrientation::Absolute, 101 ) );
+    BOOST_CHECK( selectStmt.cols().empty() );
+}
+
+BOOST_AUTO_TEST_CASE( canInsertColumnArrays )
+{
+    CreateSimpleTable< int >{ conn };
+
+    rodbc::TypedStatement< rodbc::ColumnArrays< std::tuple< int > >, std::tuple<> > insertStmt{
+        conn, "INSERT INTO tbl (col) VALUES (?)"
+    };
+
+    rodbc::Statement selectStmt{
+        conn, "SELECT col FROM tbl ORDER BY col"
+    };
+
+    auto& params = insertStmt.params();
+    params.resize( 128 );
+
+    auto* const col = params.column< 0 >().data();
+
+    for ( int index = 0; index < 128; ++index )
+    {
+        col[ index ] = index;
+    }
+
+    BOOST_CHECK_NO_THROW( insertStmt.exec() );
+
+    selectIndices( selectStmt, 128 );
+}
+
+BOOST_AUTO_TEST_CASE( canContinuePastFailedParameterSets )
+{
+    if ( conn.dbms() == rodbc::DBMS::PostgreSQL )
+    {
+        BOOST_TEST_MESSAGE( "PostgreSQL aborts the transaction after the first failed parameter set." );
+
+        return;
+    }
+
+    rodbc::CreateTable< std::tuple< int >, 0 >{
+        conn, "tbl", { "col" },
+        rodbc::DROP_TABLE_IF_EXISTS | rodbc::TEMPORARY_TABLE
+    };
+
+    rodbc::TypedStatement< std::vector< std::tuple< int > >, std::tuple<> > insertStmt{
+        conn, "INSERT INTO tbl (col) VALUES (?)"
+    };
+
+    insertStmt.setContinueOnError( true );
+
+    auto& params = insertStmt.params();
+    params.resize( 128 );
+
+    for ( int index = 0; index < 128; ++index )
+    {
+        std::get< 0 >( params[ index ] ) = index % 100;
+    }
+
+    BOOST_CHECK_NO_THROW( insertStmt.exec() );
+
+    BOOST_CHECK_EQUAL( 128, insertStmt.paramsProcessed() );
+
+    const auto& status = insertStmt.paramStatus();
+
+    for ( int index = 0; index < 128; ++index )
+    {
+        BOOST_CHECK( ( index < 100 ? rodbc::ParamStatus::Success : rodbc::ParamStatus::Error ) == status[ index ] );
+    }
+
+    rodbc::Statement selectStmt{
+        conn, "SELECT col FROM tbl ORDER BY col"
+    };
+
+    selectIndices( selectStmt, 100 );
+}
+
+BOOST_AUTO_TEST_CASE( canReportFailedParamArraysWithoutThrowing )
+{
+    rodbc::CreateTable< std::tuple< int >, 0 >{
+        conn, "tbl", { "col" },
+        rodbc::DROP_TABLE_IF_EXISTS | rodbc::TEMPORARY_TABLE
+    };
+
+    rodbc::TypedStatement< std::vector< std::tuple< int > >, std::tuple<> > insertStmt{
+        conn, "INSERT INTO tbl (col) VALUES (?)"
+    };
+
+    insertStmt.params().emplace_back( 0 );
+    insertStmt.params().emplace_back( 1 );
+
+    BOOST_CHECK( insertStmt.tryExec().ok() );
+
+    const auto status = insertStmt.tryExec();
+    BOOST_CHECK( !status.ok() );
+    BOOST_CHECK( status.isConstraintViolation() );
+}
+
+BOOST_AUTO_TEST_CASE( canFetchColumnArrays )
+{
+    CreateSimpleTable< int >{ conn };
+
+    rodbc::Statement insertStmt{
+        conn, "INSERT INTO tbl (col) VALUES (?)"
+    };
+
+    insertIndices( insertStmt, 256 );
+
+    rodbc::TypedStatement< std::tuple<>, rodbc::ColumnArrays< std::tuple< int > > > selectStmt{
+        conn, "SELECT col FROM tbl ORDER BY col", 128
+    };
+
+    selectIndices( selectStmt, 256 );
+
+    selectStmt.setFetchSize( 64 );
+    selectIndices( selectStmt, 256 );
+
+    selectStmt.setFetchSize( 256 );
+    selectIndices( selectStmt, 256 );
+}
+
+BOOST_AUTO_TEST_CASE( canReportTruncatedRows )
+{
+    CreateSimpleTable< rodbc::String< 16 > >{ conn };
+
+    rodbc::TypedStatement< std::vector< std::tuple< rodbc::String< 16 > > >, std::tuple<> > insertStmt{
+        conn, "INSERT INTO tbl (col) VALUES (?)"
+    };
+
+    insertStmt.params() = {
+        std::make_tuple( rodbc::String< 16 >{ "abc" } ),
+        std::make_tuple( rodbc::String< 16 >{ "defghijk" } ),
+        std::make_tuple( rodbc::String< 16 >{ "lmno" } )
+    };
+
+    BOOST_CHECK_NO_THROW( insertStmt.exec() );
+
+    rodbc::TypedStatement< std::tuple<>, std::vector< std::tuple< rodbc::String< 4 > > > > selectStmt{
+        conn, "SELECT col FROM tbl ORDER BY col", 8
+    };
+
+    BOOST_CHECK_NO_THROW( selectStmt.exec() );
+    BOOST_CHECK( selectStmt.fetch() );
+
+    const auto& cols = selectStmt.cols();
+    const auto& rowStatus = selectStmt.rowStatus();
+
+    BOOST_REQUIRE_EQUAL( 3, cols.size() );
+    BOOST_REQUIRE_EQUAL( 3, rowStatus.size() );
+
+    BOOST_CHECK( rowStatus[ 0 ] == rodbc::RowStatus::Success );
+    BOOST_CHECK( !std::get< 0 >( cols[ 0 ] ).isTruncated() );
+    BOOST_CHECK_EQUAL( "abc", std::get< 0 >( cols[ 0 ] ).str() );
+
+    BOOST_CHECK( rowStatus[ 1 ] == rodbc::RowStatus::SuccessWithInfo );
+    BOOST_CHECK( std::get< 0 >( cols[ 1 ] ).isTruncated() );
+    BOOST_CHECK_EQUAL( "defg", std::get< 0 >( cols[ 1 ] ).str() );
+
+    BOOST_CHECK( rowStatus[ 2 ] == rodbc::RowStatus::Success );
+    BOOST_CHECK( !std::get< 0 >( cols[ 2 ] ).isTruncated() );
+    BOOST_CHECK_EQUAL( "lmno", std::get< 0 >( cols[ 2 ] ).str() );
+
+    BOOST_CHECK( !selectStmt.fetch() );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
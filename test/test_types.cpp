@@ -101,6 +101,117 @@ BOOST_FIXTURE_TEST_CASE( canInsertAndSelectNumber, Fixture )
 
 BOOST_AUTO_TEST_SUITE_END()
 
+BOOST_AUTO_TEST_SUITE( string )
+
+BOOST_AUTO_TEST_CASE( canCompareStrings )
+{
+    const rodbc::String< 8 > prefix{ "ab" };
+    const rodbc::String< 8 > string{ "abc" };
+
+    BOOST_CHECK( prefix != string );
+    BOOST_CHECK( prefix < string );
+    BOOST_CHECK( !( string < prefix ) );
+    BOOST_CHECK( string > prefix );
+    BOOST_CHECK( string == rodbc::String< 8 >{ "abc" } );
+    BOOST_CHECK( string <= rodbc::String< 8 >{ "abc" } );
+    BOOST_CHECK( !( string < rodbc::String< 8 >{ "abc" } ) );
+}
+
+BOOST_AUTO_TEST_CASE( canCompareNullStrings )
+{
+    const rodbc::String< 8 > null;
+    const rodbc::String< 8 > empty{ "" };
+
+    BOOST_CHECK( null == rodbc::String< 8 >{} );
+    BOOST_CHECK( !( null < rodbc::String< 8 >{} ) );
+    BOOST_CHECK( null != empty );
+    BOOST_CHECK( null < empty );
+    BOOST_CHECK( !( empty < null ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE( blob )
+
+BOOST_AUTO_TEST_CASE( canCompareBlobs )
+{
+    const rodbc::Blob< 4 > prefix{ "\x01\x02", 2 };
+    const rodbc::Blob< 4 > blob{ "\x01\x02\x00\xff", 4 };
+
+    BOOST_CHECK( prefix != blob );
+    BOOST_CHECK( prefix < blob );
+    BOOST_CHECK( blob == rodbc::Blob< 4 >{ blob } );
+    BOOST_CHECK_EQUAL( std::hash< rodbc::Blob< 4 > >{}( blob ), std::hash< rodbc::Blob< 4 > >{}( rodbc::Blob< 4 >{ blob } ) );
+}
+
+BOOST_AUTO_TEST_CASE( canDetectThatBlobIsTooLarge )
+{
+    BOOST_CHECK_THROW( rodbc::Blob< 4 >( "\x01\x02\x03\x04\x05", 5 ), std::range_error );
+}
+
+BOOST_FIXTURE_TEST_CASE( canInsertAndSelectBlob, Fixture )
+{
+    rodbc::CreateTable< std::tuple< rodbc::Blob< 16 > >, 0 >{
+        conn, "tbl", { "col" },
+        rodbc::DROP_TABLE_IF_EXISTS | rodbc::TEMPORARY_TABLE
+    };
+
+    const rodbc::Blob< 16 > blob{ "\x00\x01\x7f\x80\xfe\xff", 6 };
+
+    {
+        rodbc::Statement stmt{ conn, "INSERT INTO tbl (col) VALUES (?)" };
+
+        stmt.bindParam( blob );
+
+        BOOST_CHECK_NO_THROW( stmt.exec() );
+    }
+
+    {
+        rodbc::Statement stmt{ conn, "SELECT col FROM tbl" };
+
+        rodbc::Blob< 16 > col;
+        stmt.bindCol( col );
+
+        BOOST_CHECK_NO_THROW( stmt.exec() );
+        BOOST_CHECK( stmt.fetch() );
+
+        BOOST_CHECK_EQUAL( 6, col.size() );
+        BOOST_CHECK( blob == col );
+    }
+}
+
+BOOST_FIXTURE_TEST_CASE( canInsertAndSelectNullableBlob, Fixture )
+{
+    rodbc::CreateTable< std::tuple< rodbc::Nullable< rodbc::Blob< 16 > > > >{
+        conn, "tbl", { "col" },
+        rodbc::DROP_TABLE_IF_EXISTS | rodbc::TEMPORARY_TABLE
+    };
+
+    {
+        rodbc::Statement stmt{ conn, "INSERT INTO tbl (col) VALUES (?)" };
+
+        rodbc::Nullable< rodbc::Blob< 16 > > param;
+        stmt.bindParam( param );
+
+        BOOST_CHECK_NO_THROW( stmt.exec() );
+    }
+
+    {
+        rodbc::Statement stmt{ conn, "SELECT col FROM tbl" };
+
+        rodbc::Nullable< rodbc::Blob< 16 > > col{ rodbc::Blob< 16 >{ "\x01", 1 } };
+        stmt.bindCol( col );
+
+        BOOST_CHECK_NO_THROW( stmt.exec() );
+        BOOST_CHECK( stmt.fetch() );
+
+        BOOST_CHECK( col.isNull() );
+        BOOST_CHECK( col.value() == nullptr );
+    }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
 BOOST_AUTO_TEST_SUITE( timestamp )
 
 constexpr auto epoch = rodbc::Timestamp{